@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bus1.dir/bus1.cpp.o"
+  "CMakeFiles/bus1.dir/bus1.cpp.o.d"
+  "bus1"
+  "bus1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bus1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
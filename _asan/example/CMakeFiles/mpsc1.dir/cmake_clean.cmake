@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpsc1.dir/mpsc1.cpp.o"
+  "CMakeFiles/mpsc1.dir/mpsc1.cpp.o.d"
+  "mpsc1"
+  "mpsc1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpsc1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oneshot1.dir/oneshot1.cpp.o"
+  "CMakeFiles/oneshot1.dir/oneshot1.cpp.o.d"
+  "oneshot1"
+  "oneshot1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oneshot1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
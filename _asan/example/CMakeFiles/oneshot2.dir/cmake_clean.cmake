@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oneshot2.dir/oneshot2.cpp.o"
+  "CMakeFiles/oneshot2.dir/oneshot2.cpp.o.d"
+  "oneshot2"
+  "oneshot2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oneshot2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/watch1.dir/watch1.cpp.o"
+  "CMakeFiles/watch1.dir/watch1.cpp.o.d"
+  "watch1"
+  "watch1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/watch1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/catch_main.dir/catch_main.cpp.o"
+  "CMakeFiles/catch_main.dir/catch_main.cpp.o.d"
+  "libcatch_main.a"
+  "libcatch_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
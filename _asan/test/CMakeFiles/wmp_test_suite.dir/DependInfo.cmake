@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/src/async.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/async.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/async.cpp.o.d"
+  "/root/repo/test/src/backend.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/backend.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/backend.cpp.o.d"
+  "/root/repo/test/src/bus.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/bus.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/bus.cpp.o.d"
+  "/root/repo/test/src/mpmc.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/mpmc.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/mpmc.cpp.o.d"
+  "/root/repo/test/src/mpsc.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/mpsc.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/mpsc.cpp.o.d"
+  "/root/repo/test/src/native_handle.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/native_handle.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/native_handle.cpp.o.d"
+  "/root/repo/test/src/oneshot.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/oneshot.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/oneshot.cpp.o.d"
+  "/root/repo/test/src/select.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/select.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/select.cpp.o.d"
+  "/root/repo/test/src/spsc.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/spsc.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/spsc.cpp.o.d"
+  "/root/repo/test/src/stats.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/stats.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/stats.cpp.o.d"
+  "/root/repo/test/src/trace.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/trace.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/trace.cpp.o.d"
+  "/root/repo/test/src/wake.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/wake.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/wake.cpp.o.d"
+  "/root/repo/test/src/watch.cpp" "test/CMakeFiles/wmp_test_suite.dir/src/watch.cpp.o" "gcc" "test/CMakeFiles/wmp_test_suite.dir/src/watch.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan/test/CMakeFiles/catch_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,36 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wmp_test_suite.dir/src/async.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/async.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/backend.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/backend.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/bus.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/bus.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/mpmc.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/mpmc.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/mpsc.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/mpsc.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/native_handle.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/native_handle.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/oneshot.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/oneshot.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/select.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/select.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/spsc.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/spsc.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/stats.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/stats.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/trace.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/trace.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/wake.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/wake.cpp.o.d"
+  "CMakeFiles/wmp_test_suite.dir/src/watch.cpp.o"
+  "CMakeFiles/wmp_test_suite.dir/src/watch.cpp.o.d"
+  "wmp_test_suite"
+  "wmp_test_suite.pdb"
+  "wmp_test_suite_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wmp_test_suite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan/test/wmp_test_suite_tests-b12d07c.cmake")
+  include("/root/repo/_asan/test/wmp_test_suite_tests-b12d07c.cmake")
+else()
+  add_test(wmp_test_suite_NOT_BUILT-b12d07c wmp_test_suite_NOT_BUILT-b12d07c)
+endif()
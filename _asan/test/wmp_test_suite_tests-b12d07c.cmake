@@ -0,0 +1,233 @@
+add_test( [==[wmp::mpsc async_recv completes without suspending when a value is available]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc async_recv completes without suspending when a value is available]==]  )
+set_tests_properties( [==[wmp::mpsc async_recv completes without suspending when a value is available]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc async_recv resumes on the executor once a value is sent]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc async_recv resumes on the executor once a value is sent]==]  )
+set_tests_properties( [==[wmp::mpsc async_recv resumes on the executor once a value is sent]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc many suspended receivers share a single thread]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc many suspended receivers share a single thread]==]  )
+set_tests_properties( [==[wmp::mpsc many suspended receivers share a single thread]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc a signal racing a suspending receiver never resumes it early]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc a signal racing a suspending receiver never resumes it early]==]  )
+set_tests_properties( [==[wmp::mpsc a signal racing a suspending receiver never resumes it early]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc async_send suspends on a full buffer until the receiver frees space]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc async_send suspends on a full buffer until the receiver frees space]==]  )
+set_tests_properties( [==[wmp::mpsc async_send suspends on a full buffer until the receiver frees space]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc destroying a suspended task withdraws its registration]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc destroying a suspended task withdraws its registration]==]  )
+set_tests_properties( [==[wmp::mpsc destroying a suspended task withdraws its registration]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot async_recv resumes on send or close]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot async_recv resumes on send or close]==]  )
+set_tests_properties( [==[wmp::oneshot async_recv resumes on send or close]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch changed() resumes on broadcast and on sender drop]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch changed() resumes on broadcast and on sender drop]==]  )
+set_tests_properties( [==[wmp::watch changed() resumes on broadcast and on sender drop]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::detail::srw_lock provides mutual exclusion for writers]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::detail::srw_lock provides mutual exclusion for writers]==]  )
+set_tests_properties( [==[wmp::detail::srw_lock provides mutual exclusion for writers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::detail::srw_lock admits multiple concurrent readers]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::detail::srw_lock admits multiple concurrent readers]==]  )
+set_tests_properties( [==[wmp::detail::srw_lock admits multiple concurrent readers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::detail::cond_var sleep() wakes on wake_one()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::detail::cond_var sleep() wakes on wake_one()]==]  )
+set_tests_properties( [==[wmp::detail::cond_var sleep() wakes on wake_one()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::detail::cond_var sleep() expires after timeout]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::detail::cond_var sleep() expires after timeout]==]  )
+set_tests_properties( [==[wmp::detail::cond_var sleep() expires after timeout]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::detail::deadline saturates and expires]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::detail::deadline saturates and expires]==]  )
+set_tests_properties( [==[wmp::detail::deadline saturates and expires]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::detail::wait_on_address() honors sub-millisecond deadlines]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::detail::wait_on_address() honors sub-millisecond deadlines]==]  )
+set_tests_properties( [==[wmp::detail::wait_on_address() honors sub-millisecond deadlines]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus every receiver observes every message]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus every receiver observes every message]==]  )
+set_tests_properties( [==[wmp::bus every receiver observes every message]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus subscribe() observes only later messages]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus subscribe() observes only later messages]==]  )
+set_tests_properties( [==[wmp::bus subscribe() observes only later messages]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus backpressure is applied by the slowest receiver]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus backpressure is applied by the slowest receiver]==]  )
+set_tests_properties( [==[wmp::bus backpressure is applied by the slowest receiver]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus lagged receivers skip ahead and report the skip count]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus lagged receivers skip ahead and report the skip count]==]  )
+set_tests_properties( [==[wmp::bus lagged receivers skip ahead and report the skip count]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus send fails once every receiver is dropped]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus send fails once every receiver is dropped]==]  )
+set_tests_properties( [==[wmp::bus send fails once every receiver is dropped]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus handles release their bus when assigned over]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus handles release their bus when assigned over]==]  )
+set_tests_properties( [==[wmp::bus handles release their bus when assigned over]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus a message whose copy throws does not stall receivers]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus a message whose copy throws does not stall receivers]==]  )
+set_tests_properties( [==[wmp::bus a message whose copy throws does not stall receivers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus multiple producers, multiple blocking consumers]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus multiple producers\, multiple blocking consumers]==]  )
+set_tests_properties( [==[wmp::bus multiple producers, multiple blocking consumers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::bus lagged receivers never observe a message being overwritten]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::bus lagged receivers never observe a message being overwritten]==]  )
+set_tests_properties( [==[wmp::bus lagged receivers never observe a message being overwritten]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpmc basic non-blocking send and receive]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpmc basic non-blocking send and receive]==]  )
+set_tests_properties( [==[wmp::mpmc basic non-blocking send and receive]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpmc timeouts expire]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpmc timeouts expire]==]  )
+set_tests_properties( [==[wmp::mpmc timeouts expire]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpmc disconnection is observed by both sides]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpmc disconnection is observed by both sides]==]  )
+set_tests_properties( [==[wmp::mpmc disconnection is observed by both sides]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpmc handles release their channel when assigned over]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpmc handles release their channel when assigned over]==]  )
+set_tests_properties( [==[wmp::mpmc handles release their channel when assigned over]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpmc multiple producers, multiple blocking consumers]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpmc multiple producers\, multiple blocking consumers]==]  )
+set_tests_properties( [==[wmp::mpmc multiple producers, multiple blocking consumers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc basic non-blocking send and receive]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc basic non-blocking send and receive]==]  )
+set_tests_properties( [==[wmp::mpsc basic non-blocking send and receive]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc try_send() on full buffer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc try_send() on full buffer]==]  )
+set_tests_properties( [==[wmp::mpsc try_send() on full buffer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc sender explicit clone()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc sender explicit clone()]==]  )
+set_tests_properties( [==[wmp::mpsc sender explicit clone()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc sender send_timeout() expiration]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc sender send_timeout() expiration]==]  )
+set_tests_properties( [==[wmp::mpsc sender send_timeout() expiration]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc multiple blocking producers, single blocking consumer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc multiple blocking producers\, single blocking consumer]==]  )
+set_tests_properties( [==[wmp::mpsc multiple blocking producers, single blocking consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc unbounded channel never reports full]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc unbounded channel never reports full]==]  )
+set_tests_properties( [==[wmp::mpsc unbounded channel never reports full]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc unbounded channel, multiple producers, blocking consumer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc unbounded channel\, multiple producers\, blocking consumer]==]  )
+set_tests_properties( [==[wmp::mpsc unbounded channel, multiple producers, blocking consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc unbounded channel recv_timeout() expiration]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc unbounded channel recv_timeout() expiration]==]  )
+set_tests_properties( [==[wmp::mpsc unbounded channel recv_timeout() expiration]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc recv_until() and send_until() respect absolute deadlines]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc recv_until() and send_until() respect absolute deadlines]==]  )
+set_tests_properties( [==[wmp::mpsc recv_until() and send_until() respect absolute deadlines]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc try_send_many() enqueues only what fits]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc try_send_many() enqueues only what fits]==]  )
+set_tests_properties( [==[wmp::mpsc try_send_many() enqueues only what fits]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc try_send_many() never waits, however many producers contend]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc try_send_many() never waits\, however many producers contend]==]  )
+set_tests_properties( [==[wmp::mpsc try_send_many() never waits, however many producers contend]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc a value whose constructor throws does not stall the channel]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc a value whose constructor throws does not stall the channel]==]  )
+set_tests_properties( [==[wmp::mpsc a value whose constructor throws does not stall the channel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc unbounded channel enqueues nothing from a batch whose constructor throws]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc unbounded channel enqueues nothing from a batch whose constructor throws]==]  )
+set_tests_properties( [==[wmp::mpsc unbounded channel enqueues nothing from a batch whose constructor throws]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc a batch receive that throws keeps the values not yet received]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc a batch receive that throws keeps the values not yet received]==]  )
+set_tests_properties( [==[wmp::mpsc a batch receive that throws keeps the values not yet received]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc segmented channel skips a value whose constructor throws]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc segmented channel skips a value whose constructor throws]==]  )
+set_tests_properties( [==[wmp::mpsc segmented channel skips a value whose constructor throws]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc send_many() / recv_many() across threads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc send_many() / recv_many() across threads]==]  )
+set_tests_properties( [==[wmp::mpsc send_many() / recv_many() across threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc unbounded drain() takes every queued value]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc unbounded drain() takes every queued value]==]  )
+set_tests_properties( [==[wmp::mpsc unbounded drain() takes every queued value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc move-only payloads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc move-only payloads]==]  )
+set_tests_properties( [==[wmp::mpsc move-only payloads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc sharded channel bounds each sender separately]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc sharded channel bounds each sender separately]==]  )
+set_tests_properties( [==[wmp::mpsc sharded channel bounds each sender separately]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc sharded channel reuses the sub-queues of dropped senders]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc sharded channel reuses the sub-queues of dropped senders]==]  )
+set_tests_properties( [==[wmp::mpsc sharded channel reuses the sub-queues of dropped senders]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc sharded channel, multiple blocking producers, blocking consumer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc sharded channel\, multiple blocking producers\, blocking consumer]==]  )
+set_tests_properties( [==[wmp::mpsc sharded channel, multiple blocking producers, blocking consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc priority channel drains higher priorities first]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc priority channel drains higher priorities first]==]  )
+set_tests_properties( [==[wmp::mpsc priority channel drains higher priorities first]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc priority channel bounds each priority separately]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc priority channel bounds each priority separately]==]  )
+set_tests_properties( [==[wmp::mpsc priority channel bounds each priority separately]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc priority channel, multiple producers, blocking consumer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc priority channel\, multiple producers\, blocking consumer]==]  )
+set_tests_properties( [==[wmp::mpsc priority channel, multiple producers, blocking consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc drop_newest overflow discards values sent to a full channel]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc drop_newest overflow discards values sent to a full channel]==]  )
+set_tests_properties( [==[wmp::mpsc drop_newest overflow discards values sent to a full channel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc drop_oldest overflow keeps the most recent values]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc drop_oldest overflow keeps the most recent values]==]  )
+set_tests_properties( [==[wmp::mpsc drop_oldest overflow keeps the most recent values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc drop_oldest overflow, multiple producers, blocking consumer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc drop_oldest overflow\, multiple producers\, blocking consumer]==]  )
+set_tests_properties( [==[wmp::mpsc drop_oldest overflow, multiple producers, blocking consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc segmented channel shrinks back after a burst]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc segmented channel shrinks back after a burst]==]  )
+set_tests_properties( [==[wmp::mpsc segmented channel shrinks back after a burst]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc segmented channel, multiple producers, blocking consumer]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc segmented channel\, multiple producers\, blocking consumer]==]  )
+set_tests_properties( [==[wmp::mpsc segmented channel, multiple producers, blocking consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc any channel stores small messages inline and dispatches by type]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc any channel stores small messages inline and dispatches by type]==]  )
+set_tests_properties( [==[wmp::mpsc any channel stores small messages inline and dispatches by type]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc any channel destroys every message exactly once]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc any channel destroys every message exactly once]==]  )
+set_tests_properties( [==[wmp::mpsc any channel destroys every message exactly once]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc any channel across threads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc any channel across threads]==]  )
+set_tests_properties( [==[wmp::mpsc any channel across threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc native handle is signaled while values are available]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc native handle is signaled while values are available]==]  )
+set_tests_properties( [==[wmp::mpsc native handle is signaled while values are available]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc native handle is written once per empty-to-nonempty transition]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc native handle is written once per empty-to-nonempty transition]==]  )
+set_tests_properties( [==[wmp::mpsc native handle is written once per empty-to-nonempty transition]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc native handle accounts for values sent before its creation]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc native handle accounts for values sent before its creation]==]  )
+set_tests_properties( [==[wmp::mpsc native handle accounts for values sent before its creation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc native handle wakes a poller on another thread]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc native handle wakes a poller on another thread]==]  )
+set_tests_properties( [==[wmp::mpsc native handle wakes a poller on another thread]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot native handle is signaled on send or close]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot native handle is signaled on send or close]==]  )
+set_tests_properties( [==[wmp::oneshot native handle is signaled on send or close]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch native handle is signaled while an update is unseen]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch native handle is signaled while an update is unseen]==]  )
+set_tests_properties( [==[wmp::watch native handle is signaled while an update is unseen]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp receivers with a native handle may be assigned over]==] /root/repo/_asan/test/wmp_test_suite [==[wmp receivers with a native handle may be assigned over]==]  )
+set_tests_properties( [==[wmp receivers with a native handle may be assigned over]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot single-threaded async_send(), try_recv()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot single-threaded async_send()\, try_recv()]==]  )
+set_tests_properties( [==[wmp::oneshot single-threaded async_send(), try_recv()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot single-threaded sender explicit close(), receiver try_recv()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot single-threaded sender explicit close()\, receiver try_recv()]==]  )
+set_tests_properties( [==[wmp::oneshot single-threaded sender explicit close(), receiver try_recv()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot single-threaded sender explicit close(), receiver recv()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot single-threaded sender explicit close()\, receiver recv()]==]  )
+set_tests_properties( [==[wmp::oneshot single-threaded sender explicit close(), receiver recv()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot single-threaded receiver explicit close(), sender send_async()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot single-threaded receiver explicit close()\, sender send_async()]==]  )
+set_tests_properties( [==[wmp::oneshot single-threaded receiver explicit close(), sender send_async()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot single-threaded receiver explicit close(), sender send_sync()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot single-threaded receiver explicit close()\, sender send_sync()]==]  )
+set_tests_properties( [==[wmp::oneshot single-threaded receiver explicit close(), sender send_sync()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot move-only payload with emplace_async()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot move-only payload with emplace_async()]==]  )
+set_tests_properties( [==[wmp::oneshot move-only payload with emplace_async()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot blocking recv() across threads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot blocking recv() across threads]==]  )
+set_tests_properties( [==[wmp::oneshot blocking recv() across threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot recv_timeout() expires, then still receives a later value]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot recv_timeout() expires\, then still receives a later value]==]  )
+set_tests_properties( [==[wmp::oneshot recv_timeout() expires, then still receives a later value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot send_sync() completes when the value is received]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot send_sync() completes when the value is received]==]  )
+set_tests_properties( [==[wmp::oneshot send_sync() completes when the value is received]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot send_sync() fails when the receiver drops without receiving]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot send_sync() fails when the receiver drops without receiving]==]  )
+set_tests_properties( [==[wmp::oneshot send_sync() fails when the receiver drops without receiving]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot value sent before close() is still available to try_recv()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot value sent before close() is still available to try_recv()]==]  )
+set_tests_properties( [==[wmp::oneshot value sent before close() is still available to try_recv()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot a value that is never received is destroyed]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot a value that is never received is destroyed]==]  )
+set_tests_properties( [==[wmp::oneshot a value that is never received is destroyed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot channels created from a pool recycle their state]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot channels created from a pool recycle their state]==]  )
+set_tests_properties( [==[wmp::oneshot channels created from a pool recycle their state]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot move-assigning a sender closes the channel it held]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot move-assigning a sender closes the channel it held]==]  )
+set_tests_properties( [==[wmp::oneshot move-assigning a sender closes the channel it held]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::select reports a receiver that is already ready]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::select reports a receiver that is already ready]==]  )
+set_tests_properties( [==[wmp::select reports a receiver that is already ready]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::select_timeout expires when no receiver is ready]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::select_timeout expires when no receiver is ready]==]  )
+set_tests_properties( [==[wmp::select_timeout expires when no receiver is ready]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::select wakes on a send from another thread]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::select wakes on a send from another thread]==]  )
+set_tests_properties( [==[wmp::select wakes on a send from another thread]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::select treats closure as readiness]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::select treats closure as readiness]==]  )
+set_tests_properties( [==[wmp::select treats closure as readiness]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::select leaves no waiter registered once it returns]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::select leaves no waiter registered once it returns]==]  )
+set_tests_properties( [==[wmp::select leaves no waiter registered once it returns]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::spsc sender is neither copyable nor clonable]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::spsc sender is neither copyable nor clonable]==]  )
+set_tests_properties( [==[wmp::spsc sender is neither copyable nor clonable]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::spsc basic non-blocking send and receive]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::spsc basic non-blocking send and receive]==]  )
+set_tests_properties( [==[wmp::spsc basic non-blocking send and receive]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::spsc batched send and receive]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::spsc batched send and receive]==]  )
+set_tests_properties( [==[wmp::spsc batched send and receive]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::spsc a batch receive that throws keeps the values not yet received]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::spsc a batch receive that throws keeps the values not yet received]==]  )
+set_tests_properties( [==[wmp::spsc a batch receive that throws keeps the values not yet received]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::spsc move-only payloads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::spsc move-only payloads]==]  )
+set_tests_properties( [==[wmp::spsc move-only payloads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::spsc blocking producer and consumer preserve order]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::spsc blocking producer and consumer preserve order]==]  )
+set_tests_properties( [==[wmp::spsc blocking producer and consumer preserve order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc counts messages, depth and high-water]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc counts messages\, depth and high-water]==]  )
+set_tests_properties( [==[wmp::mpsc counts messages, depth and high-water]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc counts depth on an unbounded channel]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc counts depth on an unbounded channel]==]  )
+set_tests_properties( [==[wmp::mpsc counts depth on an unbounded channel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc counts blocked senders and parked receivers]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc counts blocked senders and parked receivers]==]  )
+set_tests_properties( [==[wmp::mpsc counts blocked senders and parked receivers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc sums counters across sending threads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc sums counters across sending threads]==]  )
+set_tests_properties( [==[wmp::mpsc sums counters across sending threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot counts its single message]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot counts its single message]==]  )
+set_tests_properties( [==[wmp::oneshot counts its single message]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot counts a parked receiver]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot counts a parked receiver]==]  )
+set_tests_properties( [==[wmp::oneshot counts a parked receiver]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch counts broadcasts and deliveries]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch counts broadcasts and deliveries]==]  )
+set_tests_properties( [==[wmp::watch counts broadcasts and deliveries]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::trace records sends and receives on the calling thread]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::trace records sends and receives on the calling thread]==]  )
+set_tests_properties( [==[wmp::trace records sends and receives on the calling thread]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::trace keeps only the most recent events of a thread]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::trace keeps only the most recent events of a thread]==]  )
+set_tests_properties( [==[wmp::trace keeps only the most recent events of a thread]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::trace records a block with its duration]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::trace records a block with its duration]==]  )
+set_tests_properties( [==[wmp::trace records a block with its duration]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::trace records wakes across threads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::trace records wakes across threads]==]  )
+set_tests_properties( [==[wmp::trace records wakes across threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::trace reuses the rings of exited threads]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::trace reuses the rings of exited threads]==]  )
+set_tests_properties( [==[wmp::trace reuses the rings of exited threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::trace writes Chrome trace JSON]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::trace writes Chrome trace JSON]==]  )
+set_tests_properties( [==[wmp::trace writes Chrome trace JSON]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::mpsc issues no wakes in the non-blocking steady state]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::mpsc issues no wakes in the non-blocking steady state]==]  )
+set_tests_properties( [==[wmp::mpsc issues no wakes in the non-blocking steady state]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot issues no wakes when the receiver is not parked]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot issues no wakes when the receiver is not parked]==]  )
+set_tests_properties( [==[wmp::oneshot issues no wakes when the receiver is not parked]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::oneshot wakes a parked receiver]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::oneshot wakes a parked receiver]==]  )
+set_tests_properties( [==[wmp::oneshot wakes a parked receiver]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch issues no wakes when no receiver is parked]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch issues no wakes when no receiver is parked]==]  )
+set_tests_properties( [==[wmp::watch issues no wakes when no receiver is parked]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch channel closed when final receiver handle dropped]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch channel closed when final receiver handle dropped]==]  )
+set_tests_properties( [==[wmp::watch channel closed when final receiver handle dropped]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch move-only payload observed through borrow()]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch move-only payload observed through borrow()]==]  )
+set_tests_properties( [==[wmp::watch move-only payload observed through borrow()]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch trivially copyable values are seqlocked]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch trivially copyable values are seqlocked]==]  )
+set_tests_properties( [==[wmp::watch trivially copyable values are seqlocked]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch seqlocked readers never observe a torn value]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch seqlocked readers never observe a torn value]==]  )
+set_tests_properties( [==[wmp::watch seqlocked readers never observe a torn value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch blocked receivers are all woken by a broadcast]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch blocked receivers are all woken by a broadcast]==]  )
+set_tests_properties( [==[wmp::watch blocked receivers are all woken by a broadcast]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch recv_timeout() expires without an update]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch recv_timeout() expires without an update]==]  )
+set_tests_properties( [==[wmp::watch recv_timeout() expires without an update]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+add_test( [==[wmp::watch move-assigning a sender closes the channel it held]==] /root/repo/_asan/test/wmp_test_suite [==[wmp::watch move-assigning a sender closes the channel it held]==]  )
+set_tests_properties( [==[wmp::watch move-assigning a sender closes the channel it held]==] PROPERTIES WORKING_DIRECTORY /root/repo/_asan/test)
+set( wmp_test_suite_TESTS [==[wmp::mpsc async_recv completes without suspending when a value is available]==] [==[wmp::mpsc async_recv resumes on the executor once a value is sent]==] [==[wmp::mpsc many suspended receivers share a single thread]==] [==[wmp::mpsc a signal racing a suspending receiver never resumes it early]==] [==[wmp::mpsc async_send suspends on a full buffer until the receiver frees space]==] [==[wmp::mpsc destroying a suspended task withdraws its registration]==] [==[wmp::oneshot async_recv resumes on send or close]==] [==[wmp::watch changed() resumes on broadcast and on sender drop]==] [==[wmp::detail::srw_lock provides mutual exclusion for writers]==] [==[wmp::detail::srw_lock admits multiple concurrent readers]==] [==[wmp::detail::cond_var sleep() wakes on wake_one()]==] [==[wmp::detail::cond_var sleep() expires after timeout]==] [==[wmp::detail::deadline saturates and expires]==] [==[wmp::detail::wait_on_address() honors sub-millisecond deadlines]==] [==[wmp::bus every receiver observes every message]==] [==[wmp::bus subscribe() observes only later messages]==] [==[wmp::bus backpressure is applied by the slowest receiver]==] [==[wmp::bus lagged receivers skip ahead and report the skip count]==] [==[wmp::bus send fails once every receiver is dropped]==] [==[wmp::bus handles release their bus when assigned over]==] [==[wmp::bus a message whose copy throws does not stall receivers]==] [==[wmp::bus multiple producers, multiple blocking consumers]==] [==[wmp::bus lagged receivers never observe a message being overwritten]==] [==[wmp::mpmc basic non-blocking send and receive]==] [==[wmp::mpmc timeouts expire]==] [==[wmp::mpmc disconnection is observed by both sides]==] [==[wmp::mpmc handles release their channel when assigned over]==] [==[wmp::mpmc multiple producers, multiple blocking consumers]==] [==[wmp::mpsc basic non-blocking send and receive]==] [==[wmp::mpsc try_send() on full buffer]==] [==[wmp::mpsc sender explicit clone()]==] [==[wmp::mpsc sender send_timeout() expiration]==] [==[wmp::mpsc multiple blocking producers, single blocking consumer]==] [==[wmp::mpsc unbounded channel never reports full]==] [==[wmp::mpsc unbounded channel, multiple producers, blocking consumer]==] [==[wmp::mpsc unbounded channel recv_timeout() expiration]==] [==[wmp::mpsc recv_until() and send_until() respect absolute deadlines]==] [==[wmp::mpsc try_send_many() enqueues only what fits]==] [==[wmp::mpsc try_send_many() never waits, however many producers contend]==] [==[wmp::mpsc a value whose constructor throws does not stall the channel]==] [==[wmp::mpsc unbounded channel enqueues nothing from a batch whose constructor throws]==] [==[wmp::mpsc a batch receive that throws keeps the values not yet received]==] [==[wmp::mpsc segmented channel skips a value whose constructor throws]==] [==[wmp::mpsc send_many() / recv_many() across threads]==] [==[wmp::mpsc unbounded drain() takes every queued value]==] [==[wmp::mpsc move-only payloads]==] [==[wmp::mpsc sharded channel bounds each sender separately]==] [==[wmp::mpsc sharded channel reuses the sub-queues of dropped senders]==] [==[wmp::mpsc sharded channel, multiple blocking producers, blocking consumer]==] [==[wmp::mpsc priority channel drains higher priorities first]==] [==[wmp::mpsc priority channel bounds each priority separately]==] [==[wmp::mpsc priority channel, multiple producers, blocking consumer]==] [==[wmp::mpsc drop_newest overflow discards values sent to a full channel]==] [==[wmp::mpsc drop_oldest overflow keeps the most recent values]==] [==[wmp::mpsc drop_oldest overflow, multiple producers, blocking consumer]==] [==[wmp::mpsc segmented channel shrinks back after a burst]==] [==[wmp::mpsc segmented channel, multiple producers, blocking consumer]==] [==[wmp::mpsc any channel stores small messages inline and dispatches by type]==] [==[wmp::mpsc any channel destroys every message exactly once]==] [==[wmp::mpsc any channel across threads]==] [==[wmp::mpsc native handle is signaled while values are available]==] [==[wmp::mpsc native handle is written once per empty-to-nonempty transition]==] [==[wmp::mpsc native handle accounts for values sent before its creation]==] [==[wmp::mpsc native handle wakes a poller on another thread]==] [==[wmp::oneshot native handle is signaled on send or close]==] [==[wmp::watch native handle is signaled while an update is unseen]==] [==[wmp receivers with a native handle may be assigned over]==] [==[wmp::oneshot single-threaded async_send(), try_recv()]==] [==[wmp::oneshot single-threaded sender explicit close(), receiver try_recv()]==] [==[wmp::oneshot single-threaded sender explicit close(), receiver recv()]==] [==[wmp::oneshot single-threaded receiver explicit close(), sender send_async()]==] [==[wmp::oneshot single-threaded receiver explicit close(), sender send_sync()]==] [==[wmp::oneshot move-only payload with emplace_async()]==] [==[wmp::oneshot blocking recv() across threads]==] [==[wmp::oneshot recv_timeout() expires, then still receives a later value]==] [==[wmp::oneshot send_sync() completes when the value is received]==] [==[wmp::oneshot send_sync() fails when the receiver drops without receiving]==] [==[wmp::oneshot value sent before close() is still available to try_recv()]==] [==[wmp::oneshot a value that is never received is destroyed]==] [==[wmp::oneshot channels created from a pool recycle their state]==] [==[wmp::oneshot move-assigning a sender closes the channel it held]==] [==[wmp::select reports a receiver that is already ready]==] [==[wmp::select_timeout expires when no receiver is ready]==] [==[wmp::select wakes on a send from another thread]==] [==[wmp::select treats closure as readiness]==] [==[wmp::select leaves no waiter registered once it returns]==] [==[wmp::spsc sender is neither copyable nor clonable]==] [==[wmp::spsc basic non-blocking send and receive]==] [==[wmp::spsc batched send and receive]==] [==[wmp::spsc a batch receive that throws keeps the values not yet received]==] [==[wmp::spsc move-only payloads]==] [==[wmp::spsc blocking producer and consumer preserve order]==] [==[wmp::mpsc counts messages, depth and high-water]==] [==[wmp::mpsc counts depth on an unbounded channel]==] [==[wmp::mpsc counts blocked senders and parked receivers]==] [==[wmp::mpsc sums counters across sending threads]==] [==[wmp::oneshot counts its single message]==] [==[wmp::oneshot counts a parked receiver]==] [==[wmp::watch counts broadcasts and deliveries]==] [==[wmp::trace records sends and receives on the calling thread]==] [==[wmp::trace keeps only the most recent events of a thread]==] [==[wmp::trace records a block with its duration]==] [==[wmp::trace records wakes across threads]==] [==[wmp::trace reuses the rings of exited threads]==] [==[wmp::trace writes Chrome trace JSON]==] [==[wmp::mpsc issues no wakes in the non-blocking steady state]==] [==[wmp::oneshot issues no wakes when the receiver is not parked]==] [==[wmp::oneshot wakes a parked receiver]==] [==[wmp::watch issues no wakes when no receiver is parked]==] [==[wmp::watch channel closed when final receiver handle dropped]==] [==[wmp::watch move-only payload observed through borrow()]==] [==[wmp::watch trivially copyable values are seqlocked]==] [==[wmp::watch seqlocked readers never observe a torn value]==] [==[wmp::watch blocked receivers are all woken by a broadcast]==] [==[wmp::watch recv_timeout() expires without an update]==] [==[wmp::watch move-assigning a sender closes the channel it held]==])
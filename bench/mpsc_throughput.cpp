@@ -0,0 +1,143 @@
+// mpsc_throughput.cpp
+//
+// Multi-producer throughput of wmp::mpsc versus a lock-based baseline.
+//
+// For each producer count, every producer sends a fixed number of messages
+// through a single channel while one consumer drains it; the reported figure
+// is total messages per second over the wall-clock time of the run.
+
+#include <queue>
+#include <mutex>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <optional>
+#include <condition_variable>
+
+#include <wmp/mpsc.hpp>
+
+constexpr static auto const SUCCESS = 0x0;
+
+constexpr static std::size_t const CAPACITY = 1024;
+constexpr static std::size_t const MESSAGES = 1 << 20;
+
+// the pre-ring implementation: one lock around a std::queue
+template <typename T>
+class locked_queue
+{
+    std::mutex              m_lock;
+    std::condition_variable m_nonfull;
+    std::condition_variable m_nonempty;
+    std::queue<T>           m_buffer;
+    std::size_t const       m_capacity;
+
+public:
+    explicit locked_queue(std::size_t const capacity)
+        : m_capacity{capacity} {}
+
+    auto send(T value) -> void
+    {
+        {
+            auto lock = std::unique_lock{m_lock};
+            m_nonfull.wait(lock, [this]{ return m_buffer.size() < m_capacity; });
+            m_buffer.push(std::move(value));
+        }
+        m_nonempty.notify_one();
+    }
+
+    auto recv() -> std::optional<T>
+    {
+        auto value = std::optional<T>{};
+        {
+            auto lock = std::unique_lock{m_lock};
+            m_nonempty.wait(lock, [this]{ return !m_buffer.empty(); });
+            value.emplace(std::move(m_buffer.front()));
+            m_buffer.pop();
+        }
+        m_nonfull.notify_one();
+        return value;
+    }
+};
+
+// run() - `make_producer` is invoked once per producer thread to produce its send function
+template <typename MakeProducer, typename Recv>
+auto run(std::size_t const producers, MakeProducer make_producer, Recv recv) -> double
+{
+    using namespace std::chrono;
+
+    auto const per_producer = MESSAGES / producers;
+    auto const total        = per_producer * producers;
+
+    auto const start = steady_clock::now();
+
+    auto threads = std::vector<std::thread>{};
+    for (auto i = std::size_t{0}; i < producers; ++i)
+    {
+        threads.emplace_back([send = make_producer(), per_producer]() mutable {
+            for (auto j = std::size_t{0}; j < per_producer; ++j)
+            {
+                send(static_cast<uint64_t>(j));
+            }
+        });
+    }
+
+    for (auto i = std::size_t{0}; i < total; ++i)
+    {
+        recv();
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    auto const elapsed = duration_cast<duration<double>>(steady_clock::now() - start);
+    return static_cast<double>(total) / elapsed.count();
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    using namespace wmp;
+
+    auto const hw  = std::max(1u, std::thread::hardware_concurrency());
+    auto const max = argc > 1
+        ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10))
+        : static_cast<std::size_t>(std::max(16u, 2 * hw));
+
+    printf("%-10s %18s %18s %18s\n", "producers", "wmp::mpsc msg/s", "unbounded msg/s", "locked msg/s");
+
+    for (auto producers = std::size_t{1}; producers <= max; producers *= 2)
+    {
+        auto [tx, rx] = mpsc::create<uint64_t>(CAPACITY);
+        auto const ring = run(
+            producers,
+            [&tx = tx]() {
+                return [local = tx.clone()](uint64_t v) mutable { local.send(v); };
+            },
+            [&rx = rx]() { rx.recv(); });
+
+        auto [utx, urx] = mpsc::create_unbounded<uint64_t>();
+        auto const unbounded = run(
+            producers,
+            [&utx = utx]() {
+                return [local = utx.clone()](uint64_t v) mutable { local.send(v); };
+            },
+            [&urx = urx]() { urx.recv(); });
+
+        auto baseline = locked_queue<uint64_t>{CAPACITY};
+        auto const locked = run(
+            producers,
+            [&baseline]() {
+                return [&baseline](uint64_t v) { baseline.send(v); };
+            },
+            [&baseline]() { baseline.recv(); });
+
+        printf("%-10zu %18.0f %18.0f %18.0f\n", producers, ring, unbounded, locked);
+    }
+
+    return SUCCESS;
+}
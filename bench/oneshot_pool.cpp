@@ -0,0 +1,69 @@
+// oneshot_pool.cpp
+//
+// Request / reply rate of wmp::oneshot with and without a channel pool.
+//
+// Every thread repeatedly creates a channel, sends a value, receives it and
+// drops both handles; the reported figure is completed round trips per
+// second across all threads.
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+#include <wmp/oneshot.hpp>
+
+constexpr static auto const SUCCESS = 0x0;
+
+constexpr static std::size_t const ITERATIONS = 1 << 20;
+
+// run() - round trips per second across `threads` threads
+template <typename Create>
+auto run(std::size_t const threads, Create create) -> double
+{
+    using namespace std::chrono;
+
+    auto const start = steady_clock::now();
+
+    auto workers = std::vector<std::thread>{};
+    for (auto i = std::size_t{0}; i < threads; ++i)
+    {
+        workers.emplace_back([&create]() {
+            for (auto j = std::size_t{0}; j < ITERATIONS; ++j)
+            {
+                auto [tx, rx] = create();
+                tx.send_async(static_cast<uint64_t>(j));
+                rx.recv();
+            }
+        });
+    }
+
+    for (auto& w : workers)
+    {
+        w.join();
+    }
+
+    auto const elapsed = duration_cast<duration<double>>(steady_clock::now() - start);
+    return static_cast<double>(ITERATIONS * threads) / elapsed.count();
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    using namespace wmp;
+
+    auto const threads = argc > 1
+        ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10))
+        : std::size_t{8};
+
+    auto p = oneshot::pool<uint64_t>{};
+
+    auto const heap   = run(threads, []() { return oneshot::create<uint64_t>(); });
+    auto const pooled = run(threads, [&p]() { return oneshot::create(p); });
+
+    printf("%-10s %18s %18s\n", "threads", "make_shared ops/s", "pool ops/s");
+    printf("%-10zu %18.0f %18.0f\n", threads, heap, pooled);
+
+    return SUCCESS;
+}
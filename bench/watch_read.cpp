@@ -0,0 +1,111 @@
+// watch_read.cpp
+//
+// Read throughput of wmp::watch as the number of readers grows.
+//
+// Every reader borrow()s the current value in a tight loop while the sender
+// keeps broadcasting; the reported figure is total reads per second. A
+// trivially copyable value takes the seqlock path, in which readers never
+// write shared memory; the same value behind a user-provided copy
+// constructor takes the lock-based path for comparison.
+
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#include <wmp/watch.hpp>
+
+constexpr static auto const SUCCESS = 0x0;
+
+constexpr static std::size_t const READS = 1 << 20;
+
+struct tick
+{
+    uint64_t sequence;
+    uint64_t bid;
+    uint64_t ask;
+};
+
+// the same payload, but no longer trivially copyable
+struct locked_tick : tick
+{
+    locked_tick() = default;
+    locked_tick(tick const& t)
+        : tick{t} {}
+    locked_tick(locked_tick const& other)
+        : tick{other} {}
+    locked_tick& operator=(locked_tick const&) = default;
+};
+
+// run() - total borrow()s per second across `readers` threads
+template <typename T>
+auto run(std::size_t const readers) -> double
+{
+    using namespace std::chrono;
+    using namespace wmp;
+
+    static_assert(watch::detail::is_seqlocked_v<tick>);
+    static_assert(!watch::detail::is_seqlocked_v<locked_tick>);
+
+    auto [tx, rx] = watch::create<T>(tick{0, 0, 0});
+    auto done = std::atomic<bool>{false};
+
+    auto sender = std::thread{[&tx = tx, &done]() {
+        for (auto i = uint64_t{1}; !done.load(std::memory_order_relaxed); ++i)
+        {
+            tx.broadcast(tick{i, i, i + 1});
+            std::this_thread::yield();
+        }
+    }};
+
+    auto const start = steady_clock::now();
+
+    auto threads = std::vector<std::thread>{};
+    for (auto i = std::size_t{0}; i < readers; ++i)
+    {
+        threads.emplace_back([local = rx.clone()]() mutable {
+            auto sink = uint64_t{0};
+            for (auto j = std::size_t{0}; j < READS; ++j)
+            {
+                sink += (*local.borrow()).bid;
+            }
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            static_cast<void>(sink);
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    auto const elapsed = duration_cast<duration<double>>(steady_clock::now() - start);
+
+    done.store(true);
+    sender.join();
+
+    return static_cast<double>(READS * readers) / elapsed.count();
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    auto const hw  = std::max(1u, std::thread::hardware_concurrency());
+    auto const max = argc > 1
+        ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10))
+        : static_cast<std::size_t>(hw);
+
+    printf("%-10s %18s %18s\n", "readers", "seqlock reads/s", "locked reads/s");
+
+    for (auto readers = std::size_t{1}; readers <= max; readers *= 2)
+    {
+        auto const seqlock = run<tick>(readers);
+        auto const locked  = run<locked_tick>(readers);
+        printf("%-10zu %18.0f %18.0f\n", readers, seqlock, locked);
+    }
+
+    return SUCCESS;
+}
@@ -0,0 +1,108 @@
+// watch_wake.cpp
+//
+// Broadcast-to-all-woken latency of wmp::watch.
+//
+// Every receiver parks in recv(); once all of them are parked the sender
+// broadcasts, and each receiver stamps the time at which recv() returned.
+// The reported figure for a round is the time from the broadcast to the
+// last receiver's stamp, summarized over many rounds.
+
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#include <wmp/watch.hpp>
+
+constexpr static auto const SUCCESS = 0x0;
+
+constexpr static std::size_t const ROUNDS = 200;
+
+// run() - per-round latencies, in microseconds, for `receivers` receivers
+auto run(std::size_t const receivers) -> std::vector<double>
+{
+    using namespace std::chrono;
+    using namespace wmp;
+
+    auto [tx, rx] = watch::create<uint64_t>(0);
+    rx.recv();
+
+    auto arrived = std::atomic<std::size_t>{0};
+    auto stamps  = std::vector<steady_clock::time_point>(receivers);
+
+    auto threads = std::vector<std::thread>{};
+    for (auto i = std::size_t{0}; i < receivers; ++i)
+    {
+        threads.emplace_back([&arrived, &stamp = stamps[i], local = rx.clone()]() mutable {
+            while (local.recv().has_value())
+            {
+                stamp = steady_clock::now();
+                arrived.fetch_add(1, std::memory_order_release);
+            }
+        });
+    }
+
+    auto latencies = std::vector<double>{};
+    for (auto round = std::size_t{1}; round <= ROUNDS; ++round)
+    {
+        // give every receiver time to get past its spin phase and park
+        std::this_thread::sleep_for(milliseconds{2});
+
+        auto const start = steady_clock::now();
+        tx.broadcast(round);
+
+        while (arrived.load(std::memory_order_acquire) != round * receivers)
+        {
+            std::this_thread::yield();
+        }
+
+        auto const last = *std::max_element(stamps.begin(), stamps.end());
+        latencies.push_back(duration_cast<duration<double, std::micro>>(last - start).count());
+    }
+
+    // dropping the sender releases every receiver
+    {
+        auto drop = std::move(tx);
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    return latencies;
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    auto counts = std::vector<std::size_t>{};
+    for (auto i = 1; i < argc; ++i)
+    {
+        counts.push_back(static_cast<std::size_t>(std::strtoul(argv[i], nullptr, 10)));
+    }
+
+    if (counts.empty())
+    {
+        counts = {1, 16, 256};
+    }
+
+    printf("%-10s %14s %14s %14s\n", "receivers", "p50 us", "p99 us", "max us");
+
+    for (auto const receivers : counts)
+    {
+        auto latencies = run(receivers);
+        std::sort(latencies.begin(), latencies.end());
+
+        auto const at = [&](double const q) {
+            return latencies[static_cast<std::size_t>(q * static_cast<double>(latencies.size() - 1))];
+        };
+
+        printf("%-10zu %14.1f %14.1f %14.1f\n", receivers, at(0.50), at(0.99), latencies.back());
+    }
+
+    return SUCCESS;
+}
@@ -0,0 +1,743 @@
+// wmp_bench.cpp
+//
+// Throughput sweep of the wmp channels against a std::mutex + std::deque baseline.
+//
+// Every combination of producer count, consumer count, capacity and payload
+// size is run once per channel, for both wmp and the baseline; each run
+// reports messages per second over the wall-clock time from the moment all
+// threads are released until the last one has finished. Results are written
+// to stdout as CSV (the default) or JSON.
+//
+// The channels measured are:
+//  - mpsc:    `producers` senders, a single receiver (consumer sweep ignored);
+//             also run as a sharded channel (engine `wmp_sharded`), with the
+//             capacity divided between the senders' sub-queues
+//  - mpmc:    `producers` senders, `consumers` receivers
+//  - oneshot: `producers` clients each make round trips to `consumers` servers;
+//             every request carries a fresh oneshot channel for its reply
+//  - watch:   a single sender broadcasts to `consumers` receivers (producer
+//             and capacity sweeps ignored); a receiver may skip versions, so
+//             `received` counts the updates actually delivered
+//
+// usage: wmp_bench [--channels=mpsc,mpmc,oneshot,watch] [--producers=1,2,4,8]
+//                  [--consumers=1,2,4] [--capacity=64,1024] [--payload=8,64,256]
+//                  [--messages=262144] [--format=csv|json]
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+#include <condition_variable>
+
+#include <wmp/mpsc.hpp>
+#include <wmp/mpmc.hpp>
+#include <wmp/watch.hpp>
+#include <wmp/oneshot.hpp>
+
+constexpr static auto const SUCCESS = 0x0;
+constexpr static auto const FAILURE = 0x1;
+
+// ----------------------------------------------------------------------------
+// payload
+
+// payload - a trivially copyable message of exactly N bytes
+template <std::size_t N>
+struct payload
+{
+    static_assert(N >= sizeof(uint64_t));
+
+    uint64_t                                      seq;
+    std::array<unsigned char, N - sizeof(uint64_t)> pad;
+};
+
+// the payload sizes a sweep may select from
+constexpr static std::size_t const PAYLOAD_SIZES[] = {8, 64, 256, 1024};
+
+// ----------------------------------------------------------------------------
+// baselines
+
+// mutex_deque - the baseline queue: one lock around a std::deque
+template <typename T>
+class mutex_deque
+{
+    std::mutex              m_lock;
+    std::condition_variable m_nonfull;
+    std::condition_variable m_nonempty;
+    std::deque<T>           m_buffer;
+    std::size_t const       m_capacity;
+
+public:
+    explicit mutex_deque(std::size_t const capacity)
+        : m_capacity{capacity} {}
+
+    auto send(T value) -> void
+    {
+        {
+            auto lock = std::unique_lock{m_lock};
+            m_nonfull.wait(lock, [this]{ return m_buffer.size() < m_capacity; });
+            m_buffer.push_back(std::move(value));
+        }
+        m_nonempty.notify_one();
+    }
+
+    auto recv() -> T
+    {
+        auto lock = std::unique_lock{m_lock};
+        m_nonempty.wait(lock, [this]{ return !m_buffer.empty(); });
+        auto value = std::move(m_buffer.front());
+        m_buffer.pop_front();
+        lock.unlock();
+
+        m_nonfull.notify_one();
+        return value;
+    }
+};
+
+// mutex_latest - the baseline watch: one lock around the latest value and its version
+template <typename T>
+class mutex_latest
+{
+    std::mutex              m_lock;
+    std::condition_variable m_changed;
+    T                       m_value;
+    uint64_t                m_version;
+    bool                    m_closed;
+
+public:
+    mutex_latest()
+        : m_value{}
+        , m_version{0}
+        , m_closed{false} {}
+
+    auto broadcast(T const& value) -> void
+    {
+        {
+            auto guard = std::lock_guard{m_lock};
+            m_value = value;
+            ++m_version;
+        }
+        m_changed.notify_all();
+    }
+
+    auto close() -> void
+    {
+        {
+            auto guard = std::lock_guard{m_lock};
+            m_closed = true;
+        }
+        m_changed.notify_all();
+    }
+
+    // recv() - wait for a version newer than `seen`; empty once closed
+    auto recv(uint64_t& seen) -> std::optional<T>
+    {
+        auto lock = std::unique_lock{m_lock};
+        m_changed.wait(lock, [&]{ return m_version > seen || m_closed; });
+        if (m_version == seen)
+        {
+            return std::nullopt;
+        }
+
+        seen = m_version;
+        return m_value;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// harness
+
+struct shape
+{
+    std::size_t producers;
+    std::size_t consumers;
+    std::size_t capacity;
+    std::size_t payload;
+    std::size_t messages;
+};
+
+struct result
+{
+    char const* channel;
+    char const* engine;
+    shape       dims;
+    std::size_t received;
+    double      seconds;
+};
+
+// gate - releases every thread of a run at once
+class gate
+{
+    std::atomic<bool> m_open{false};
+
+public:
+    auto wait() const -> void
+    {
+        while (!m_open.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    auto open() -> void
+    {
+        m_open.store(true, std::memory_order_release);
+    }
+};
+
+// share() - the number of messages handled by participant `i` of `n`
+inline auto share(std::size_t const total, std::size_t const n, std::size_t const i) -> std::size_t
+{
+    return total / n + (i < total % n ? 1 : 0);
+}
+
+// run() - invoke every `producer(i)` and `consumer(i)` on its own thread
+//
+// Producers and consumers return the number of messages they handled;
+// the result reports the consumers' total and the elapsed time.
+template <typename Producer, typename Consumer>
+auto run(
+    std::size_t const producers,
+    Producer          producer,
+    std::size_t const consumers,
+    Consumer          consumer) -> std::pair<std::size_t, double>
+{
+    using namespace std::chrono;
+
+    auto go       = gate{};
+    auto received = std::atomic<std::size_t>{0};
+
+    auto threads = std::vector<std::thread>{};
+    for (auto i = std::size_t{0}; i < producers; ++i)
+    {
+        threads.emplace_back([&, i]() { go.wait(); producer(i); });
+    }
+    for (auto i = std::size_t{0}; i < consumers; ++i)
+    {
+        threads.emplace_back([&, i]() { go.wait(); received += consumer(i); });
+    }
+
+    auto const start = steady_clock::now();
+    go.open();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    auto const elapsed = duration_cast<duration<double>>(steady_clock::now() - start);
+
+    return {received.load(), elapsed.count()};
+}
+
+// ----------------------------------------------------------------------------
+// channels
+
+template <typename P>
+auto bench_mpsc(shape const& s, std::vector<result>& out) -> void
+{
+    auto const total = s.messages;
+
+    auto const measure = [&](auto& tx, auto& rx) {
+        auto senders = std::vector<std::decay_t<decltype(tx)>>{};
+        for (auto i = std::size_t{0}; i < s.producers; ++i)
+        {
+            senders.push_back(tx.clone());
+        }
+
+        return run(
+            s.producers,
+            [&](std::size_t const i) {
+                for (auto j = std::size_t{0}, n = share(total, s.producers, i); j < n; ++j)
+                {
+                    senders[i].send(P{j, {}});
+                }
+            },
+            1,
+            [&](std::size_t) {
+                for (auto j = std::size_t{0}; j < total; ++j)
+                {
+                    rx.recv();
+                }
+                return total;
+            });
+    };
+
+    {
+        auto [tx, rx] = wmp::mpsc::create<P>(s.capacity);
+        auto const [received, seconds] = measure(tx, rx);
+        out.push_back({"mpsc", "wmp", s, received, seconds});
+    }
+
+    {
+        auto [tx, rx] = wmp::mpsc::create_sharded<P>(std::max(s.capacity / s.producers, std::size_t{1}));
+        auto const [received, seconds] = measure(tx, rx);
+        out.push_back({"mpsc", "wmp_sharded", s, received, seconds});
+    }
+
+    {
+        auto queue = mutex_deque<P>{s.capacity};
+        auto const [received, seconds] = run(
+            s.producers,
+            [&](std::size_t const i) {
+                for (auto j = std::size_t{0}, n = share(total, s.producers, i); j < n; ++j)
+                {
+                    queue.send(P{j, {}});
+                }
+            },
+            1,
+            [&](std::size_t) {
+                for (auto j = std::size_t{0}; j < total; ++j)
+                {
+                    queue.recv();
+                }
+                return total;
+            });
+        out.push_back({"mpsc", "baseline", s, received, seconds});
+    }
+}
+
+template <typename P>
+auto bench_mpmc(shape const& s, std::vector<result>& out) -> void
+{
+    auto const total = s.messages;
+
+    {
+        auto [tx, rx]  = wmp::mpmc::create<P>(s.capacity);
+        auto senders   = std::vector<wmp::mpmc::sender<P>>{};
+        auto receivers = std::vector<wmp::mpmc::receiver<P>>{};
+        for (auto i = std::size_t{0}; i < s.producers; ++i)
+        {
+            senders.push_back(tx.clone());
+        }
+        for (auto i = std::size_t{0}; i < s.consumers; ++i)
+        {
+            receivers.push_back(rx.clone());
+        }
+
+        auto const [received, seconds] = run(
+            s.producers,
+            [&](std::size_t const i) {
+                for (auto j = std::size_t{0}, n = share(total, s.producers, i); j < n; ++j)
+                {
+                    senders[i].send(P{j, {}});
+                }
+            },
+            s.consumers,
+            [&](std::size_t const i) {
+                auto const n = share(total, s.consumers, i);
+                for (auto j = std::size_t{0}; j < n; ++j)
+                {
+                    receivers[i].recv();
+                }
+                return n;
+            });
+        out.push_back({"mpmc", "wmp", s, received, seconds});
+    }
+
+    {
+        auto queue = mutex_deque<P>{s.capacity};
+        auto const [received, seconds] = run(
+            s.producers,
+            [&](std::size_t const i) {
+                for (auto j = std::size_t{0}, n = share(total, s.producers, i); j < n; ++j)
+                {
+                    queue.send(P{j, {}});
+                }
+            },
+            s.consumers,
+            [&](std::size_t const i) {
+                auto const n = share(total, s.consumers, i);
+                for (auto j = std::size_t{0}; j < n; ++j)
+                {
+                    queue.recv();
+                }
+                return n;
+            });
+        out.push_back({"mpmc", "baseline", s, received, seconds});
+    }
+}
+
+template <typename P>
+auto bench_oneshot(shape const& s, std::vector<result>& out) -> void
+{
+    auto const total = s.messages;
+
+    {
+        struct request
+        {
+            P                        value;
+            wmp::oneshot::sender<P> reply;
+        };
+
+        auto [tx, rx]  = wmp::mpmc::create<request>(s.capacity);
+        auto clients   = std::vector<wmp::mpmc::sender<request>>{};
+        auto servers   = std::vector<wmp::mpmc::receiver<request>>{};
+        for (auto i = std::size_t{0}; i < s.producers; ++i)
+        {
+            clients.push_back(tx.clone());
+        }
+        for (auto i = std::size_t{0}; i < s.consumers; ++i)
+        {
+            servers.push_back(rx.clone());
+        }
+
+        auto const [received, seconds] = run(
+            s.producers,
+            [&](std::size_t const i) {
+                for (auto j = std::size_t{0}, n = share(total, s.producers, i); j < n; ++j)
+                {
+                    auto [reply_tx, reply_rx] = wmp::oneshot::create<P>();
+                    clients[i].send(request{P{j, {}}, std::move(reply_tx)});
+                    reply_rx.recv();
+                }
+            },
+            s.consumers,
+            [&](std::size_t const i) {
+                auto const n = share(total, s.consumers, i);
+                for (auto j = std::size_t{0}; j < n; ++j)
+                {
+                    auto r = servers[i].recv();
+                    r->reply.send_async(r->value);
+                }
+                return n;
+            });
+        out.push_back({"oneshot", "wmp", s, received, seconds});
+    }
+
+    {
+        struct request
+        {
+            P                               value;
+            std::shared_ptr<mutex_deque<P>> reply;
+        };
+
+        auto queue = mutex_deque<request>{s.capacity};
+        auto const [received, seconds] = run(
+            s.producers,
+            [&](std::size_t const i) {
+                for (auto j = std::size_t{0}, n = share(total, s.producers, i); j < n; ++j)
+                {
+                    auto reply = std::make_shared<mutex_deque<P>>(1);
+                    queue.send(request{P{j, {}}, reply});
+                    reply->recv();
+                }
+            },
+            s.consumers,
+            [&](std::size_t const i) {
+                auto const n = share(total, s.consumers, i);
+                for (auto j = std::size_t{0}; j < n; ++j)
+                {
+                    auto r = queue.recv();
+                    r.reply->send(r.value);
+                }
+                return n;
+            });
+        out.push_back({"oneshot", "baseline", s, received, seconds});
+    }
+}
+
+template <typename P>
+auto bench_watch(shape const& s, std::vector<result>& out) -> void
+{
+    auto const total = s.messages;
+
+    {
+        auto [tx, rx]  = wmp::watch::create<P>(P{});
+        auto receivers = std::vector<wmp::watch::receiver<P>>{};
+        for (auto i = std::size_t{0}; i < s.consumers; ++i)
+        {
+            receivers.push_back(rx.clone());
+        }
+
+        auto sender = std::optional<wmp::watch::sender<P>>{std::move(tx)};
+        auto const [received, seconds] = run(
+            1,
+            [&](std::size_t) {
+                for (auto j = std::size_t{0}; j < total; ++j)
+                {
+                    sender->broadcast(P{j, {}});
+                }
+                // closes the channel
+                sender.reset();
+            },
+            s.consumers,
+            [&](std::size_t const i) {
+                auto n = std::size_t{0};
+                while (receivers[i].recv().has_value())
+                {
+                    ++n;
+                }
+                return n;
+            });
+        out.push_back({"watch", "wmp", s, received, seconds});
+    }
+
+    {
+        auto latest = mutex_latest<P>{};
+        auto const [received, seconds] = run(
+            1,
+            [&](std::size_t) {
+                for (auto j = std::size_t{0}; j < total; ++j)
+                {
+                    latest.broadcast(P{j, {}});
+                }
+                latest.close();
+            },
+            s.consumers,
+            [&](std::size_t) {
+                auto n    = std::size_t{0};
+                auto seen = uint64_t{0};
+                while (latest.recv(seen).has_value())
+                {
+                    ++n;
+                }
+                return n;
+            });
+        out.push_back({"watch", "baseline", s, received, seconds});
+    }
+}
+
+// ----------------------------------------------------------------------------
+// sweep
+
+struct config
+{
+    std::vector<std::string> channels  = {"mpsc", "mpmc", "oneshot", "watch"};
+    std::vector<std::size_t> producers = {1, 2, 4, 8};
+    std::vector<std::size_t> consumers = {1, 2, 4};
+    std::vector<std::size_t> capacity  = {64, 1024};
+    std::vector<std::size_t> payload   = {8, 64, 256};
+    std::size_t              messages  = std::size_t{1} << 18;
+    bool                     json      = false;
+};
+
+// bench_payload() - run `channel` for one shape, dispatching on the payload size
+template <std::size_t... Sizes>
+auto bench_payload(
+    std::string const& channel,
+    shape const&       s,
+    std::vector<result>& out,
+    std::index_sequence<Sizes...>) -> void
+{
+    auto const dispatch = [&](auto size) {
+        using P = payload<decltype(size)::value>;
+        if (s.payload != decltype(size)::value)
+        {
+            return;
+        }
+
+        if ("mpsc" == channel)
+        {
+            bench_mpsc<P>(s, out);
+        }
+        else if ("mpmc" == channel)
+        {
+            bench_mpmc<P>(s, out);
+        }
+        else if ("oneshot" == channel)
+        {
+            bench_oneshot<P>(s, out);
+        }
+        else if ("watch" == channel)
+        {
+            bench_watch<P>(s, out);
+        }
+    };
+
+    (dispatch(std::integral_constant<std::size_t, PAYLOAD_SIZES[Sizes]>{}), ...);
+}
+
+auto sweep(config const& c) -> std::vector<result>
+{
+    auto out = std::vector<result>{};
+    for (auto const& channel : c.channels)
+    {
+        // channels that ignore a dimension run it at a single value
+        auto const producers = "watch" == channel ? std::vector<std::size_t>{1} : c.producers;
+        auto const consumers = "mpsc" == channel ? std::vector<std::size_t>{1} : c.consumers;
+        auto const capacity  = "watch" == channel ? std::vector<std::size_t>{0} : c.capacity;
+
+        for (auto const p : producers)
+        for (auto const k : consumers)
+        for (auto const cap : capacity)
+        for (auto const size : c.payload)
+        {
+            bench_payload(
+                channel,
+                shape{p, k, cap, size, c.messages},
+                out,
+                std::make_index_sequence<std::size(PAYLOAD_SIZES)>{});
+            fprintf(stderr, ".");
+        }
+    }
+    fprintf(stderr, "\n");
+
+    return out;
+}
+
+// ----------------------------------------------------------------------------
+// output
+
+auto write_csv(std::vector<result> const& results) -> void
+{
+    printf("channel,engine,producers,consumers,capacity,payload_bytes,messages,received,seconds,msgs_per_sec\n");
+    for (auto const& r : results)
+    {
+        printf("%s,%s,%zu,%zu,%zu,%zu,%zu,%zu,%.6f,%.0f\n",
+            r.channel, r.engine,
+            r.dims.producers, r.dims.consumers, r.dims.capacity, r.dims.payload,
+            r.dims.messages, r.received, r.seconds,
+            static_cast<double>(r.dims.messages) / r.seconds);
+    }
+}
+
+auto write_json(std::vector<result> const& results) -> void
+{
+    printf("[\n");
+    for (auto i = std::size_t{0}; i < results.size(); ++i)
+    {
+        auto const& r = results[i];
+        printf("  {\"channel\": \"%s\", \"engine\": \"%s\", \"producers\": %zu, \"consumers\": %zu, "
+               "\"capacity\": %zu, \"payload_bytes\": %zu, \"messages\": %zu, \"received\": %zu, "
+               "\"seconds\": %.6f, \"msgs_per_sec\": %.0f}%s\n",
+            r.channel, r.engine,
+            r.dims.producers, r.dims.consumers, r.dims.capacity, r.dims.payload,
+            r.dims.messages, r.received, r.seconds,
+            static_cast<double>(r.dims.messages) / r.seconds,
+            i + 1 < results.size() ? "," : "");
+    }
+    printf("]\n");
+}
+
+// ----------------------------------------------------------------------------
+// command line
+
+auto split(char const* list) -> std::vector<std::string>
+{
+    auto out  = std::vector<std::string>{};
+    auto item = std::string{};
+    for (auto const* p = list; ; ++p)
+    {
+        if ('\0' == *p || ',' == *p)
+        {
+            if (!item.empty())
+            {
+                out.push_back(item);
+            }
+            item.clear();
+            if ('\0' == *p)
+            {
+                return out;
+            }
+        }
+        else
+        {
+            item.push_back(*p);
+        }
+    }
+}
+
+auto split_sizes(char const* list) -> std::vector<std::size_t>
+{
+    auto out = std::vector<std::size_t>{};
+    for (auto const& item : split(list))
+    {
+        out.push_back(static_cast<std::size_t>(std::strtoull(item.c_str(), nullptr, 10)));
+    }
+    return out;
+}
+
+// parse() - apply `argv` to the defaults; returns `false` on an unrecognized argument
+auto parse(int argc, char* argv[], config& c) -> bool
+{
+    for (auto i = 1; i < argc; ++i)
+    {
+        auto const arg = std::string{argv[i]};
+        auto const eq  = arg.find('=');
+        if (std::string::npos == eq)
+        {
+            return false;
+        }
+
+        auto const key   = arg.substr(0, eq);
+        auto const* value = argv[i] + eq + 1;
+        if ("--channels" == key)
+        {
+            c.channels = split(value);
+        }
+        else if ("--producers" == key)
+        {
+            c.producers = split_sizes(value);
+        }
+        else if ("--consumers" == key)
+        {
+            c.consumers = split_sizes(value);
+        }
+        else if ("--capacity" == key)
+        {
+            c.capacity = split_sizes(value);
+        }
+        else if ("--payload" == key)
+        {
+            c.payload = split_sizes(value);
+            for (auto const size : c.payload)
+            {
+                if (std::none_of(std::begin(PAYLOAD_SIZES), std::end(PAYLOAD_SIZES),
+                    [size](std::size_t s) { return s == size; }))
+                {
+                    fprintf(stderr, "unsupported payload size %zu (8, 64, 256 or 1024)\n", size);
+                    return false;
+                }
+            }
+        }
+        else if ("--messages" == key)
+        {
+            c.messages = static_cast<std::size_t>(std::strtoull(value, nullptr, 10));
+        }
+        else if ("--format" == key)
+        {
+            c.json = 0 == std::strcmp(value, "json");
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    auto c = config{};
+    if (!parse(argc, argv, c))
+    {
+        fprintf(stderr,
+            "usage: %s [--channels=mpsc,mpmc,oneshot,watch] [--producers=N,...] "
+            "[--consumers=N,...] [--capacity=N,...] [--payload=N,...] [--messages=N] "
+            "[--format=csv|json]\n", argv[0]);
+        return FAILURE;
+    }
+
+    auto const results = sweep(c);
+    if (c.json)
+    {
+        write_json(results);
+    }
+    else
+    {
+        write_csv(results);
+    }
+
+    return SUCCESS;
+}
@@ -0,0 +1,50 @@
+// bus1.cpp
+
+#include <cstdio>
+#include <thread>
+
+#include <wmp/bus.hpp>
+
+constexpr static auto const SUCCESS = 0x0;
+constexpr static auto const FAILURE = 0x1;
+
+auto main() -> int
+{
+    using namespace wmp;
+
+    auto [tx, rx1] = bus::create<int>(16);
+    auto rx2 = rx1.clone();
+
+    auto t1 = std::thread{[rx = std::move(rx1)]() mutable {
+        while (auto v = rx.recv())
+        {
+            printf("Receiver 1 got value: %d\n", v.value());
+        }
+    }};
+
+    auto t2 = std::thread{[rx = std::move(rx2)]() mutable {
+        while (auto v = rx.recv())
+        {
+            printf("Receiver 2 got value: %d\n", v.value());
+        }
+    }};
+
+    auto status = SUCCESS;
+    for (auto i = 0; i < 3; ++i)
+    {
+        if (bus::send_result::success != tx.send(i))
+        {
+            status = FAILURE;
+        }
+    }
+
+    // dropping the final sender closes the bus once receivers are drained
+    {
+        auto drop = std::move(tx);
+    }
+
+    t1.join();
+    t2.join();
+
+    return status;
+}
@@ -1,12 +1,756 @@
 // bus.hpp
+//
+// A bounded, multiple-producer, multiple-consumer broadcast channel.
+//
+// Every message is written once into a ring shared by all receivers and
+// read by each of them in turn; a receiver is nothing more than a read
+// cursor into that ring. Producers claim positions with a CAS on the head
+// index. What happens when the slowest receiver falls a full ring behind
+// is selected at creation:
+//  - policy::backpressure : senders wait for the slowest receiver
+//  - policy::lagged       : senders overwrite; receivers that fall behind
+//                           skip to the oldest retained message and report
+//                           the number of messages they missed via lagged()
+//
+// Receivers never hold up a sender: each slot carries a version, and a
+// receiver copies the message out and then checks that the version has not
+// moved on in the meantime, reporting a lag if it has.
+
+#pragma once
+
+#include <new>
+#include <tuple>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include "detail/spin.hpp"
+#include "detail/event.hpp"
+#include "detail/trace.hpp"
+#include "detail/backend.hpp"
+#include "detail/cache_line.hpp"
+#include "detail/scoped_srw.hpp"
 
 namespace wmp::bus
 {
+    // policy - the treatment of receivers that fall a full ring behind
+    enum class policy
+    {
+        backpressure,
+        lagged
+    };
+
+    // ------------------------------------------------------------------------
+    // detail::inner
+
+    namespace detail
+    {
+        // cell - the storage of a slot's message, safe to read while being overwritten
+        //
+        // A trivially copyable message is stored as a run of atomic words, so
+        // that a reader racing a writer copies out a torn value (which it then
+        // discards) rather than invoking undefined behaviour. Any other message
+        // can not be copied while it is being replaced, so it is held by a
+        // shared pointer that a reader pins before copying from it.
+        template <typename T, bool = std::is_trivially_copyable_v<T>>
+        class cell
+        {
+            constexpr static std::size_t const WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+            std::atomic<uint64_t> m_words[WORDS];
+
+        public:
+            using staged_type = T;
+
+            struct snapshot_type
+            {
+                alignas(T) unsigned char bytes[WORDS * sizeof(uint64_t)];
+            };
+
+            cell()
+            {
+                for (auto& w : m_words)
+                {
+                    w.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            template <typename... Args>
+            static auto stage(Args&&... args) -> staged_type
+            {
+                return T(std::forward<Args>(args)...);
+            }
+
+            auto store(staged_type const& value) noexcept -> void
+            {
+                auto bytes = snapshot_type{};
+                std::memcpy(bytes.bytes, &value, sizeof(T));
+
+                for (auto i = std::size_t{0}; i < WORDS; ++i)
+                {
+                    auto word = uint64_t{0};
+                    std::memcpy(&word, bytes.bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+                    m_words[i].store(word, std::memory_order_relaxed);
+                }
+            }
+
+            auto load() const noexcept -> snapshot_type
+            {
+                auto bytes = snapshot_type{};
+                for (auto i = std::size_t{0}; i < WORDS; ++i)
+                {
+                    auto const word = m_words[i].load(std::memory_order_relaxed);
+                    std::memcpy(bytes.bytes + i * sizeof(uint64_t), &word, sizeof(uint64_t));
+                }
+                return bytes;
+            }
+
+            // only called once the snapshot has been validated
+            static auto extract(snapshot_type const& snapshot, std::optional<T>& out) -> void
+            {
+                out.emplace(*std::launder(reinterpret_cast<T const*>(snapshot.bytes)));
+            }
+        };
+
+        // the pointer is guarded by a flag held only while it is copied or
+        // replaced, never while a message is copied, so a sender can wait at
+        // most for a reference count to be taken
+        template <typename T>
+        class cell<T, false>
+        {
+            std::shared_ptr<T const> m_value;
+            std::atomic<bool>        m_busy;
+
+        public:
+            using staged_type   = std::shared_ptr<T const>;
+            using snapshot_type = std::shared_ptr<T const>;
+
+            cell()
+                : m_value{}
+                , m_busy{false} {}
+
+            template <typename... Args>
+            static auto stage(Args&&... args) -> staged_type
+            {
+                return std::make_shared<T const>(std::forward<Args>(args)...);
+            }
+
+            auto store(staged_type value) noexcept -> void
+            {
+                acquire();
+                m_value.swap(value);
+                m_busy.store(false, std::memory_order_release);
+
+                // the previous message, if no reader has pinned it, is destroyed here
+            }
+
+            auto load() noexcept -> snapshot_type
+            {
+                acquire();
+                auto snapshot = m_value;
+                m_busy.store(false, std::memory_order_release);
+                return snapshot;
+            }
+
+            static auto extract(snapshot_type const& snapshot, std::optional<T>& out) -> void
+            {
+                out.emplace(*snapshot);
+            }
+
+        private:
+            auto acquire() noexcept -> void
+            {
+                while (m_busy.exchange(true, std::memory_order_acquire))
+                {
+                    wmp::detail::cpu_relax();
+                }
+            }
+        };
+
+        template <typename T>
+        struct slot
+        {
+            // 2 * (position + 1) once the message at a position is stored,
+            // one less while it is being stored; 0 if never written
+            std::atomic<uint64_t> version;
+
+            cell<T> value;
+
+            slot()
+                : version{0}
+                , value{} {}
+        };
+
+        // the read position of a single receiver
+        struct alignas(wmp::detail::CACHE_LINE_SIZE) cursor
+        {
+            std::atomic<uint64_t> position;
+
+            explicit cursor(uint64_t const initial)
+                : position{initial} {}
+        };
+
+        template <typename T>
+        struct inner
+        {
+            policy const overflow;
+
+            // read-only after construction
+            std::unique_ptr<slot<T>[]> slots;
+            uint64_t capacity;
+            uint64_t mask;
+
+            // the next position to be claimed by a sender
+            alignas(wmp::detail::CACHE_LINE_SIZE) std::atomic<uint64_t> head;
+            // last observed minimum over all receiver cursors; senders only
+            // rescan the cursors once the head has caught up with it
+            alignas(wmp::detail::CACHE_LINE_SIZE) std::atomic<uint64_t> gate;
+
+            // registered receiver cursors; guarded by subscribers_lock
+            wmp::detail::srw_lock subscribers_lock;
+            std::vector<cursor*>  subscribers;
+
+            std::atomic<uint32_t> senders;
+            std::atomic<uint32_t> receivers;
+            std::atomic<bool>     closed;
+
+            // receivers park on published, senders (under backpressure) on consumed
+            alignas(wmp::detail::CACHE_LINE_SIZE) wmp::detail::event published;
+            alignas(wmp::detail::CACHE_LINE_SIZE) wmp::detail::event consumed;
+
+            // the requested capacity is rounded up to the next power of two
+            inner(std::size_t const requested, policy const p)
+                : overflow{p}
+                , slots{}
+                , capacity{1}
+                , mask{0}
+                , head{0}
+                , gate{0}
+                , subscribers{}
+                , senders{0}
+                , receivers{0}
+                , closed{false}
+                , published{}
+                , consumed{}
+            {
+                while (capacity < requested)
+                {
+                    capacity <<= 1;
+                }
+
+                mask  = capacity - 1;
+                slots = std::make_unique<slot<T>[]>(capacity);
+            }
+
+            inner(inner const&)            = delete;
+            inner& operator=(inner const&) = delete;
+
+            inner(inner&&)            = delete;
+            inner& operator=(inner&&) = delete;
+        };
+
+        // subscribe() - register a new cursor at `position`, or at the head if none given
+        template <typename T>
+        auto subscribe(
+            inner<T>&               shared,
+            std::optional<uint64_t> position) -> std::unique_ptr<cursor>
+        {
+            using wmp::detail::scoped_srw;
+            using wmp::detail::srw_acquire;
+
+            auto guard = scoped_srw{&shared.subscribers_lock, srw_acquire::exclusive};
+
+            // a new cursor never precedes the minimum of the existing ones,
+            // so registration can not invalidate a sender's cached gate
+            auto c = std::make_unique<cursor>(position.value_or(shared.head.load()));
+            shared.subscribers.push_back(c.get());
+            shared.receivers.fetch_add(1);
+            return c;
+        }
+
+        // unsubscribe() - withdraw a cursor registered with subscribe()
+        template <typename T>
+        auto unsubscribe(inner<T>& shared, cursor* c) -> void
+        {
+            using wmp::detail::scoped_srw;
+            using wmp::detail::srw_acquire;
+
+            auto guard = scoped_srw{&shared.subscribers_lock, srw_acquire::exclusive};
+
+            auto& subscribers = shared.subscribers;
+            subscribers.erase(std::find(subscribers.begin(), subscribers.end(), c));
+            shared.receivers.fetch_sub(1);
+        }
+
+        // refresh_gate() - recompute the minimum receiver cursor
+        template <typename T>
+        auto refresh_gate(inner<T>& shared) -> uint64_t
+        {
+            using wmp::detail::scoped_srw;
+            using wmp::detail::srw_acquire;
+
+            auto guard = scoped_srw{&shared.subscribers_lock, srw_acquire::shared};
+
+            auto min = shared.head.load(std::memory_order_acquire);
+            for (auto* c : shared.subscribers)
+            {
+                min = std::min(min, c->position.load(std::memory_order_acquire));
+            }
+
+            shared.gate.store(min, std::memory_order_release);
+            return min;
+        }
+
+        enum class claim
+        {
+            claimed,
+            full,
+            disconnected
+        };
+
+        // try_claim() - attempt to claim the next position for a sender
+        template <typename T>
+        auto try_claim(inner<T>& shared, uint64_t& pos) -> claim
+        {
+            pos = shared.head.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if (0 == shared.receivers.load(std::memory_order_acquire))
+                {
+                    return claim::disconnected;
+                }
+
+                if (policy::backpressure == shared.overflow &&
+                    pos >= shared.gate.load(std::memory_order_acquire) + shared.capacity)
+                {
+                    if (pos >= refresh_gate(shared) + shared.capacity)
+                    {
+                        return claim::full;
+                    }
+                }
+
+                if (shared.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    return claim::claimed;
+                }
+            }
+        }
+
+        // publish() - store a message staged ahead of its claim and wake receivers
+        //
+        // The message must be staged (which may throw) before the position is
+        // claimed: a claimed position that is never published would stop every
+        // receiver at it for good.
+        template <typename T>
+        auto publish(inner<T>& shared, uint64_t const pos, typename cell<T>::staged_type&& staged) -> void
+        {
+            auto& s = shared.slots[pos & shared.mask];
+
+            auto const storing = 2 * pos + 1;
+            auto version = s.version.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                // under policy::lagged a sender a full lap ahead may already
+                // have claimed this slot; the older message is simply lost
+                if (version >= storing)
+                {
+                    break;
+                }
+
+                // a sender a full lap behind is still storing; only possible
+                // when this sender lapped it within a single store
+                if (version & 1)
+                {
+                    wmp::detail::cpu_relax();
+                    version = s.version.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (s.version.compare_exchange_weak(version, storing, std::memory_order_relaxed))
+                {
+                    // orders the odd version before the stores of the message,
+                    // pairs with the fence in try_read()
+                    std::atomic_thread_fence(std::memory_order_release);
+                    s.value.store(std::move(staged));
+                    s.version.store(storing + 1, std::memory_order_release);
+                    break;
+                }
+            }
+
+            wmp::detail::trace_event(wmp::detail::trace_kind::send, wmp::detail::trace_source::bus, &shared);
+            shared.published.notify_all();
+        }
+
+        enum class read
+        {
+            success,
+            empty,
+            lagged
+        };
+
+        // try_read() - attempt to copy out the message at `pos`
+        //
+        // Takes no lock: the message is copied out and then discarded if the
+        // slot's version changed meanwhile, which only a sender a full lap
+        // ahead can cause.
+        template <typename T>
+        auto try_read(inner<T>& shared, uint64_t const pos, std::optional<T>& out) -> read
+        {
+            auto& s = shared.slots[pos & shared.mask];
+            auto const stored = 2 * pos + 2;
+
+            auto const before = s.version.load(std::memory_order_acquire);
+            if (before != stored)
+            {
+                return before < stored ? read::empty : read::lagged;
+            }
+
+            auto const snapshot = s.value.load();
+
+            // orders the loads of the message before the second load of the version
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.version.load(std::memory_order_relaxed) != stored)
+            {
+                return read::lagged;
+            }
+
+            cell<T>::extract(snapshot, out);
+            return read::success;
+        }
+
+    }
+
+    // ------------------------------------------------------------------------
+    // sender
+
+    enum class send_result
+    {
+        success,
+        failure,
+        timeout
+    };
+
+    template <typename T>
+    class receiver;
+
+    template <typename T>
+    class sender
+    {
+        std::shared_ptr<detail::inner<T>> m_inner;
+
+    public:
+        sender(std::shared_ptr<detail::inner<T>> inner)
+            : m_inner{inner}
+        {
+            m_inner->senders.fetch_add(1);
+        }
+
+        ~sender()
+        {
+            release();
+        }
+
+        // non-copyable, outside explicit clone()
+        sender(sender const&)            = delete;
+        sender& operator=(sender const&) = delete;
+
+        sender(sender&&) = default;
+
+        // releases the bus previously held, as the destructor does
+        sender& operator=(sender&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_inner = std::move(other.m_inner);
+            }
+            return *this;
+        }
+
+        auto clone() -> sender<T>
+        {
+            return sender{m_inner};
+        }
+
+        // subscribe() - create a new receiver that observes messages sent from now on
+        auto subscribe() -> receiver<T>
+        {
+            return receiver<T>{m_inner, std::nullopt};
+        }
+
+        // send() - blocking send operation (indefinite timeout)
+        //
+        // Fails only if every receiver has been dropped.
+        auto send(T value) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::never());
+        }
+
+        // send_timeout() - blocking send operation with timeout
+        template <typename Duration>
+        auto send_timeout(T value, Duration timeout) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::after(timeout));
+        }
+
+        // send_until() - blocking send operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto send_until(T value, std::chrono::time_point<Clock, Duration> const& deadline) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::at(deadline));
+        }
+
+        // try_send() - non-blocking send operation
+        //
+        // Under policy::lagged a send never waits, so try_send() and send()
+        // are equivalent.
+        auto try_send(T value) -> send_result
+        {
+            auto staged = detail::cell<T>::stage(std::move(value));
+
+            auto pos = uint64_t{0};
+            if (detail::claim::claimed != detail::try_claim(*m_inner, pos))
+            {
+                return send_result::failure;
+            }
+
+            detail::publish(*m_inner, pos, std::move(staged));
+            return send_result::success;
+        }
+
+    private:
+        auto release() noexcept -> void
+        {
+            // don't attempt to close the channel when in moved-from state
+            if (m_inner && 1 == m_inner->senders.fetch_sub(1))
+            {
+                // the final sender; receivers observe closure once drained
+                m_inner->closed.store(true);
+                m_inner->published.notify_all();
+            }
+        }
+
+        auto send_by(T&& value, wmp::detail::deadline const until) -> send_result
+        {
+            auto staged = detail::cell<T>::stage(std::move(value));
+
+            auto pos    = uint64_t{0};
+            auto status = detail::claim::full;
+
+            auto const claimed = m_inner->consumed.await(
+                [&]() { return detail::claim::full != (status = detail::try_claim(*m_inner, pos)); },
+                until);
+
+            if (!claimed)
+            {
+                return send_result::timeout;
+            }
+            else if (detail::claim::disconnected == status)
+            {
+                return send_result::failure;
+            }
+
+            detail::publish(*m_inner, pos, std::move(staged));
+            return send_result::success;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // receiver
+
+    template <typename T>
+    class receiver
+    {
+        static_assert(std::is_copy_constructible_v<T>,
+            "wmp::bus delivers every message to every receiver and requires a copyable T");
+
+        std::shared_ptr<detail::inner<T>> m_inner;
+        std::unique_ptr<detail::cursor>   m_cursor;
+
+        // messages skipped since the last call to lagged();
+        // only ever accessed by the thread that owns this handle
+        uint64_t m_lagged;
+
+        friend class sender<T>;
+
+        receiver(
+            std::shared_ptr<detail::inner<T>> inner,
+            std::optional<uint64_t> const     position)
+            : m_inner{inner}
+            , m_cursor{detail::subscribe(*inner, position)}
+            , m_lagged{0}
+        {}
+
+    public:
+        ~receiver()
+        {
+            release();
+        }
+
+        // non-copyable, outside explicit clone()
+        receiver(receiver const&)            = delete;
+        receiver& operator=(receiver const&) = delete;
+
+        receiver(receiver&&) = default;
+
+        // unsubscribes from the bus previously held, as the destructor does
+        receiver& operator=(receiver&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_inner  = std::move(other.m_inner);
+                m_cursor = std::move(other.m_cursor);
+                m_lagged = other.m_lagged;
+            }
+            return *this;
+        }
+
+        // clone() - create a new receiver at the same position as this one
+        auto clone() -> receiver<T>
+        {
+            return receiver{m_inner, m_cursor->position.load(std::memory_order_relaxed)};
+        }
+
+        // recv() - blocking receive operation (indefinite timeout)
+        //
+        // Returns an empty std::optional once every sender has been dropped
+        // and every message sent before then has been received.
+        auto recv() -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::never());
+        }
+
+        // recv_timeout() - blocking receive operation with timeout
+        template <typename Duration>
+        auto recv_timeout(Duration timeout) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::after(timeout));
+        }
+
+        // recv_until() - blocking receive operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto recv_until(std::chrono::time_point<Clock, Duration> const& deadline) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::at(deadline));
+        }
+
+        // try_recv() - non-blocking receive operation
+        auto try_recv() -> std::optional<T>
+        {
+            auto value = std::optional<T>{};  // std::nullopt
+            take(value);
+            return value;
+        }
+
+        // lagged() - the number of messages skipped since the last call
+        //
+        // Always zero under policy::backpressure. Under policy::lagged a
+        // receiver that falls a full ring behind resumes from the oldest
+        // message still retained; the messages it missed are counted here.
+        auto lagged() noexcept -> uint64_t
+        {
+            return std::exchange(m_lagged, 0);
+        }
+
+    private:
+        auto release() noexcept -> void
+        {
+            // don't attempt to unsubscribe when in moved-from state
+            if (m_inner)
+            {
+                detail::unsubscribe(*m_inner, m_cursor.get());
+
+                // this may have been the slowest (or the final) receiver
+                m_inner->consumed.notify_all();
+            }
+        }
+
+        auto recv_by(wmp::detail::deadline const until) -> std::optional<T>
+        {
+            auto value = std::optional<T>{};  // std::nullopt
+
+            m_inner->published.await(
+                [&]() {
+                    if (take(value))
+                    {
+                        return true;
+                    }
+
+                    if (!m_inner->closed.load())
+                    {
+                        return false;
+                    }
+
+                    // every message published before closure is visible
+                    // once closure is, so one last attempt is conclusive
+                    take(value);
+                    return true;
+                },
+                until);
+
+            return value;
+        }
+
+        auto take(std::optional<T>& value) -> bool
+        {
+            for (;;)
+            {
+                auto const pos = m_cursor->position.load(std::memory_order_relaxed);
+                switch (detail::try_read(*m_inner, pos, value))
+                {
+                case detail::read::success:
+                    m_cursor->position.store(pos + 1, std::memory_order_release);
+                    wmp::detail::trace_event(
+                        wmp::detail::trace_kind::recv, wmp::detail::trace_source::bus, m_inner.get());
+                    if (policy::backpressure == m_inner->overflow)
+                    {
+                        m_inner->consumed.notify_all();
+                    }
+                    return true;
+
+                case detail::read::empty:
+                    return false;
+
+                case detail::read::lagged:
+                {
+                    // the slot holds a message at least a lap ahead of us, so
+                    // the head is too; resume at the oldest retained position
+                    auto const oldest = m_inner->head.load(std::memory_order_acquire) - m_inner->capacity;
+                    m_lagged += oldest - pos;
+                    m_cursor->position.store(oldest, std::memory_order_release);
+                    break;
+                }
+                }
+            }
+        }
+    };
+
     // ------------------------------------------------------------------------
     // create()
 
-    auto create() -> void
+    // create() - construct a new bus
+    //
+    // The requested capacity is rounded up to the next power of two.
+    // Further receivers are created with sender::subscribe() (observing
+    // messages sent from then on) or receiver::clone() (observing the
+    // same messages as the receiver it was cloned from).
+    template <typename T>
+    auto create(
+        std::size_t const capacity,
+        policy const      overflow = policy::backpressure) -> std::pair<sender<T>, receiver<T>>
     {
-        
+        auto shared = std::make_shared<detail::inner<T>>(capacity, overflow);
+        auto tx = sender<T>{shared};
+        auto rx = tx.subscribe();
+        return std::pair{ std::move(tx), std::move(rx) };
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,27 @@
+// backend.hpp
+//
+// Compile-time selection of the platform synchronization backend.
+//
+// Every backend provides the same two types in wmp::detail:
+//  - srw_lock: a slim reader / writer lock
+//  - cond_var: a condition variable that sleeps on an srw_lock
+//
+// along with the address waiting functions wait_on_address(),
+// wake_address_one() and wake_address_all() that park a thread directly on
+// a 32-bit atomic word. Every timed wait takes an absolute deadline
+// (deadline.hpp) rather than a relative timeout.
+//
+// Each backend also provides native_event, a manual-reset event that the
+// platform's own wait facilities (epoll, WaitForMultipleObjects) can wait on.
+
+#pragma once
+
+#if defined(_WIN32)
+#define WMP_BACKEND_WIN32 1
+#include "win32_backend.hpp"
+#elif defined(__linux__)
+#define WMP_BACKEND_FUTEX 1
+#include "futex_backend.hpp"
+#else
+#error "wmp: no synchronization backend available for the target platform"
+#endif
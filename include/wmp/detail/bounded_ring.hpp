@@ -0,0 +1,430 @@
+// bounded_ring.hpp
+//
+// A lock-free, bounded, multiple-producer single-consumer ring buffer.
+//
+// Every slot carries a sequence number that encodes both the "lap" of the
+// ring the slot belongs to and whether it is currently empty or full:
+//  - 2 * lap     : slot is empty and may be written by the producer at `lap`
+//  - 2 * lap + 1 : slot is full and may be read by the consumer at `lap`
+//
+// Producers claim a position by CAS on the head index and then publish the
+// slot by storing its sequence number; the single consumer owns the tail
+// index outright and never executes an atomic read-modify-write.
+//
+// try_pop_shared() additionally permits multiple concurrent consumers by
+// claiming positions on the tail with a CAS; it must not be mixed with
+// try_pop() on the same ring.
+//
+// A producer whose value's constructor throws after it has claimed a slot
+// still publishes that slot, marked vacant; consumers step over vacant
+// slots as though the position had never been claimed.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <type_traits>
+
+#include "cache_line.hpp"
+
+namespace wmp::detail
+{
+    template <typename T>
+    class bounded_ring
+    {
+        struct slot
+        {
+            std::atomic<uint64_t> seq;
+            // set when the slot was published without a value; ordered by `seq`
+            bool vacant;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            auto value() noexcept -> T*
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        // written by producers
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_head;
+        // written by the consumer
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_tail;
+
+        // read-only after construction
+        alignas(CACHE_LINE_SIZE) std::unique_ptr<slot[]> m_slots;
+        uint64_t m_mask;
+        unsigned m_shift;
+
+    public:
+        constexpr static bool const is_bounded = true;
+
+        // the requested capacity is rounded up to the next power of two
+        explicit bounded_ring(std::size_t const capacity)
+            : m_head{0}
+            , m_tail{0}
+            , m_slots{}
+            , m_mask{0}
+            , m_shift{0}
+        {
+            while ((uint64_t{1} << m_shift) < capacity)
+            {
+                ++m_shift;
+            }
+
+            auto const size = uint64_t{1} << m_shift;
+            m_mask  = size - 1;
+            m_slots = std::make_unique<slot[]>(size);
+            for (auto i = uint64_t{0}; i < size; ++i)
+            {
+                m_slots[i].seq.store(0, std::memory_order_relaxed);
+                m_slots[i].vacant = false;
+            }
+        }
+
+        ~bounded_ring()
+        {
+            while (try_pop().has_value()) {}
+        }
+
+        // non-copyable
+        bounded_ring(bounded_ring const&)            = delete;
+        bounded_ring& operator=(bounded_ring const&) = delete;
+
+        // non-movable
+        bounded_ring(bounded_ring&&)            = delete;
+        bounded_ring& operator=(bounded_ring&&) = delete;
+
+        // try_push() - attempt to enqueue a value, safe for concurrent producers
+        //
+        // The value is only forwarded into the ring on success; on failure
+        // (the ring is full) the argument is left untouched.
+        template <typename U>
+        auto try_push(U&& value) -> bool
+        {
+            return try_emplace(std::forward<U>(value));
+        }
+
+        // try_emplace() - attempt to construct a value in place, safe for concurrent producers
+        //
+        // The value is constructed directly in its slot from `args` once a
+        // slot has been claimed; on failure the arguments are left untouched.
+        template <typename... Args>
+        auto try_emplace(Args&&... args) -> bool
+        {
+            auto pos = m_head.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& s = m_slots[pos & m_mask];
+
+                auto const seq  = s.seq.load(std::memory_order_acquire);
+                auto const turn = (pos >> m_shift) << 1;
+                if (seq == turn)
+                {
+                    if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        fill(s, turn, std::forward<Args>(args)...);
+                        return true;
+                    }
+                }
+                else if (seq < turn)
+                {
+                    // slot still holds the value written on the previous lap
+                    return false;
+                }
+                else
+                {
+                    // another producer claimed this position
+                    pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // try_push_many() - enqueue a prefix of [first, last) with a single claim
+        //
+        // Claims as many contiguous positions as are currently free with one
+        // CAS on the head index and fills them in order. Values are constructed
+        // from `*first`; pass move iterators to move them in. Returns the
+        // iterator one past the last value enqueued.
+        template <typename ForwardIt>
+        auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+        {
+            auto const n = static_cast<uint64_t>(std::distance(first, last));
+            if (0 == n)
+            {
+                return first;
+            }
+
+            auto pos   = m_head.load(std::memory_order_relaxed);
+            auto count = uint64_t{0};
+            for (;;)
+            {
+                // count the slots free on this lap, exactly as try_emplace()
+                // checks a single one; a slot found free can only be written
+                // by the producer that claims its position, so once the CAS
+                // succeeds every claimed slot is ready to be filled
+                auto stale = false;
+                for (count = 0; count < n; ++count)
+                {
+                    auto const at   = pos + count;
+                    auto const seq  = m_slots[at & m_mask].seq.load(std::memory_order_acquire);
+                    auto const turn = (at >> m_shift) << 1;
+                    if (seq != turn)
+                    {
+                        // a later lap at the first position: another producer claimed it
+                        stale = 0 == count && seq > turn;
+                        break;
+                    }
+                }
+
+                if (stale)
+                {
+                    pos = m_head.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (0 == count)
+                {
+                    return first;
+                }
+
+                if (m_head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+
+            auto const end = pos + count;
+            for (; pos != end; ++pos, ++first)
+            {
+                auto& s = m_slots[pos & m_mask];
+                auto const turn = (pos >> m_shift) << 1;
+
+                if constexpr (std::is_nothrow_constructible_v<T, decltype(*first)>)
+                {
+                    fill(s, turn, *first);
+                }
+                else
+                {
+                    try
+                    {
+                        fill(s, turn, *first);
+                    }
+                    catch (...)
+                    {
+                        // the positions claimed but not yet filled are abandoned
+                        while (++pos != end)
+                        {
+                            abandon(m_slots[pos & m_mask], (pos >> m_shift) << 1);
+                        }
+                        throw;
+                    }
+                }
+            }
+
+            return first;
+        }
+
+        // try_pop() - attempt to dequeue a value; must only be called by the consumer
+        auto try_pop() -> std::optional<T>
+        {
+            auto pos = m_tail.load(std::memory_order_relaxed);
+            for (;; ++pos)
+            {
+                auto& s = m_slots[pos & m_mask];
+
+                auto const turn = (pos >> m_shift) << 1;
+                if (s.seq.load(std::memory_order_acquire) != turn + 1)
+                {
+                    return std::nullopt;
+                }
+
+                if (s.vacant)
+                {
+                    s.seq.store(turn + 2, std::memory_order_release);
+                    m_tail.store(pos + 1, std::memory_order_release);
+                    continue;
+                }
+
+                auto value = std::optional<T>{std::move(*s.value())};
+                s.value()->~T();
+
+                s.seq.store(turn + 2, std::memory_order_release);
+                m_tail.store(pos + 1, std::memory_order_release);
+
+                return value;
+            }
+        }
+
+        // empty() - whether try_pop() would fail; must only be called by the consumer
+        auto empty() const noexcept -> bool
+        {
+            for (auto pos = m_tail.load(std::memory_order_relaxed);; ++pos)
+            {
+                auto const& s = m_slots[pos & m_mask];
+
+                auto const turn = (pos >> m_shift) << 1;
+                if (s.seq.load(std::memory_order_acquire) != turn + 1)
+                {
+                    return true;
+                }
+
+                if (!s.vacant)
+                {
+                    return false;
+                }
+            }
+        }
+
+        // try_pop_many() - dequeue up to `max` values; must only be called by the consumer
+        //
+        // Values are written through `out`, which is advanced past them; the
+        // tail index is published once for the whole batch. Should writing a
+        // value throw, the slots released so far are published first and the
+        // value is left in its slot for the next pop.
+        template <typename OutputIt>
+        auto try_pop_many(OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            auto const start = m_tail.load(std::memory_order_relaxed);
+
+            auto pos   = start;
+            auto count = std::size_t{0};
+            try
+            {
+                while (count < max)
+                {
+                    auto& s = m_slots[pos & m_mask];
+
+                    auto const turn = (pos >> m_shift) << 1;
+                    if (s.seq.load(std::memory_order_acquire) != turn + 1)
+                    {
+                        break;
+                    }
+
+                    if (!s.vacant)
+                    {
+                        *out = std::move(*s.value());
+                        ++out;
+                        s.value()->~T();
+                        ++count;
+                    }
+
+                    s.seq.store(turn + 2, std::memory_order_release);
+                    ++pos;
+                }
+            }
+            catch (...)
+            {
+                m_tail.store(pos, std::memory_order_release);
+                throw;
+            }
+
+            if (pos != start)
+            {
+                m_tail.store(pos, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        // try_pop_shared() - attempt to dequeue a value, safe for concurrent consumers
+        auto try_pop_shared() -> std::optional<T>
+        {
+            auto pos = m_tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& s = m_slots[pos & m_mask];
+
+                auto const seq  = s.seq.load(std::memory_order_acquire);
+                auto const turn = ((pos >> m_shift) << 1) + 1;
+                if (seq == turn)
+                {
+                    if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        if (s.vacant)
+                        {
+                            s.seq.store(turn + 1, std::memory_order_release);
+                            pos = m_tail.load(std::memory_order_relaxed);
+                            continue;
+                        }
+
+                        auto value = std::optional<T>{std::move(*s.value())};
+                        s.value()->~T();
+
+                        s.seq.store(turn + 1, std::memory_order_release);
+                        return value;
+                    }
+                }
+                else if (seq < turn)
+                {
+                    // slot has not yet been written on this lap
+                    return std::nullopt;
+                }
+                else
+                {
+                    // another consumer claimed this position
+                    pos = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // size() - approximate number of values currently enqueued
+        auto size() const noexcept -> std::size_t
+        {
+            auto const tail = m_tail.load(std::memory_order_acquire);
+            auto const head = m_head.load(std::memory_order_acquire);
+
+            // the tail may be stale by the time the head is read, so the
+            // difference can briefly exceed what the ring is able to hold
+            auto const count = head > tail ? head - tail : 0;
+            return static_cast<std::size_t>(count > m_mask ? m_mask + 1 : count);
+        }
+
+        auto capacity() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(m_mask + 1);
+        }
+
+    private:
+        // fill() - construct the value for a claimed slot and publish it
+        //
+        // Should the constructor throw, the slot is published vacant before
+        // the exception propagates, so that the consumer is not left waiting
+        // on a position that will never be filled.
+        template <typename... Args>
+        auto fill(slot& s, uint64_t const turn, Args&&... args) -> void
+        {
+            if constexpr (std::is_nothrow_constructible_v<T, Args&&...>)
+            {
+                ::new (static_cast<void*>(s.storage)) T(std::forward<Args>(args)...);
+            }
+            else
+            {
+                try
+                {
+                    ::new (static_cast<void*>(s.storage)) T(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    abandon(s, turn);
+                    throw;
+                }
+            }
+
+            s.vacant = false;
+            s.seq.store(turn + 1, std::memory_order_release);
+        }
+
+        // abandon() - publish a claimed slot without a value
+        auto abandon(slot& s, uint64_t const turn) noexcept -> void
+        {
+            s.vacant = true;
+            s.seq.store(turn + 1, std::memory_order_release);
+        }
+    };
+}
@@ -0,0 +1,12 @@
+// cache_line.hpp
+
+#pragma once
+
+#include <cstddef>
+
+namespace wmp::detail
+{
+    // assumed size of a destructive-interference region; indices that are
+    // written by different threads are aligned to this to avoid false sharing
+    constexpr static std::size_t const CACHE_LINE_SIZE = 64;
+}
@@ -0,0 +1,329 @@
+// coro.hpp
+//
+// C++20 coroutine support for the channels' async operations.
+//
+// Every async operation is a lazily-started task that retries its
+// non-blocking counterpart, and between attempts suspends on a readiness
+// awaitable. That awaitable registers a waiter with the channel (exactly as
+// wmp::select() does); when the channel signals it, the suspended coroutine
+// is handed to a caller-supplied executor for resumption, so no thread is
+// ever parked on behalf of a coroutine.
+//
+// An executor is any type with a member
+//
+//     auto execute(std::coroutine_handle<> handle) -> void
+//
+// that arranges for handle.resume() to be invoked later, on any thread.
+// execute() is invoked from within a channel's notification path, with an
+// internal lock held; it must not resume the coroutine inline.
+//
+// Everything here is only available when compiling as C++20 (or later) with
+// coroutine support; WMP_HAS_COROUTINES reports whether that is the case.
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define WMP_HAS_COROUTINES 1
+#else
+#define WMP_HAS_COROUTINES 0
+#endif
+
+#if WMP_HAS_COROUTINES
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <coroutine>
+
+#include "waiter.hpp"
+
+namespace wmp::detail
+{
+    // ------------------------------------------------------------------------
+    // task
+
+    // task - the result of an async channel operation
+    //
+    // A task does not start until it is awaited, and resumes its awaiter
+    // directly (by symmetric transfer) once it completes.
+    template <typename T>
+    class task
+    {
+    public:
+        struct promise_type
+        {
+            std::optional<T>        result;
+            std::exception_ptr      error;
+            std::coroutine_handle<> continuation;
+
+            auto get_return_object() noexcept -> task
+            {
+                return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            auto initial_suspend() noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            struct final_awaiter
+            {
+                auto await_ready() noexcept -> bool
+                {
+                    return false;
+                }
+
+                auto await_suspend(std::coroutine_handle<promise_type> h) noexcept
+                    -> std::coroutine_handle<>
+                {
+                    return h.promise().continuation;
+                }
+
+                auto await_resume() noexcept -> void {}
+            };
+
+            auto final_suspend() noexcept -> final_awaiter
+            {
+                return {};
+            }
+
+            template <typename U>
+            auto return_value(U&& value) -> void
+            {
+                result.emplace(std::forward<U>(value));
+            }
+
+            auto unhandled_exception() noexcept -> void
+            {
+                error = std::current_exception();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle{handle} {}
+
+    public:
+        ~task()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        // non-copyable
+        task(task const&)            = delete;
+        task& operator=(task const&) = delete;
+
+        task(task&& other) noexcept
+            : m_handle{std::exchange(other.m_handle, nullptr)} {}
+
+        task& operator=(task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        auto await_ready() const noexcept -> bool
+        {
+            return false;
+        }
+
+        auto await_suspend(std::coroutine_handle<> awaiter) noexcept -> std::coroutine_handle<>
+        {
+            m_handle.promise().continuation = awaiter;
+            return m_handle;
+        }
+
+        auto await_resume() -> T
+        {
+            auto& promise = m_handle.promise();
+            if (promise.error)
+            {
+                std::rethrow_exception(promise.error);
+            }
+            return std::move(*promise.result);
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // resume_waiter
+
+    // resume_waiter - a waiter whose signal schedules a suspended coroutine
+    //
+    // While the coroutine is still suspending it owns its own resumption,
+    // and a signal only records that it arrived; the coroutine then declines
+    // to suspend. Once the coroutine has committed to suspending, the first
+    // signal schedules it, and later signals are absorbed.
+    template <typename Executor>
+    class resume_waiter : public waiter
+    {
+        enum state : uint32_t
+        {
+            idle,        // not awaiting a signal
+            suspending,  // registered, but the coroutine has not yet committed
+            signalled,   // signalled while suspending
+            suspended,   // committed; the next signal schedules the coroutine
+        };
+
+        Executor&               m_executor;
+        std::coroutine_handle<> m_handle;
+        std::atomic<uint32_t>   m_state;
+
+    public:
+        explicit resume_waiter(Executor& executor) noexcept
+            : waiter{&signal}
+            , m_executor{executor}
+            , m_handle{}
+            , m_state{idle} {}
+
+        // arm() - begin suspending `handle`; signals are recorded but not acted on
+        auto arm(std::coroutine_handle<> handle) noexcept -> void
+        {
+            m_handle = handle;
+            m_state.store(suspending, std::memory_order_relaxed);
+        }
+
+        // commit() - hand resumption over to the next signal
+        //
+        // Returns `false` if a signal arrived since arm(), in which case the
+        // caller must not suspend. On success the coroutine may be resumed
+        // (and destroyed) at any moment, so the caller must not touch the
+        // waiter again.
+        auto commit() noexcept -> bool
+        {
+            auto expected = uint32_t{suspending};
+            return m_state.compare_exchange_strong(expected, suspended, std::memory_order_acq_rel);
+        }
+
+        // cancel() - stop suspending; any signal since arm() is absorbed
+        auto cancel() noexcept -> void
+        {
+            m_state.store(idle, std::memory_order_relaxed);
+        }
+
+    private:
+        static auto signal(waiter& w) noexcept -> void
+        {
+            auto& self = static_cast<resume_waiter&>(w);
+
+            auto current = self.m_state.load(std::memory_order_acquire);
+            for (;;)
+            {
+                if (suspending == current)
+                {
+                    if (self.m_state.compare_exchange_weak(current, signalled, std::memory_order_acq_rel))
+                    {
+                        return;
+                    }
+                }
+                else if (suspended == current)
+                {
+                    if (self.m_state.compare_exchange_weak(current, idle, std::memory_order_acq_rel))
+                    {
+                        self.m_executor.execute(self.m_handle);
+                        return;
+                    }
+                }
+                else
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // readiness
+
+    // readiness - suspend until `ready()` may hold, resuming on `executor`
+    //
+    // Like a condition variable, a readiness wait may complete spuriously;
+    // the awaiting task re-attempts its operation and awaits again if needed.
+    template <typename Executor, typename Ready>
+    class readiness
+    {
+        waiter_list&              m_list;
+        Ready                     m_ready;
+        resume_waiter<Executor>   m_waiter;
+        bool                      m_registered;
+
+    public:
+        readiness(waiter_list& list, Executor& executor, Ready ready)
+            : m_list{list}
+            , m_ready{std::move(ready)}
+            , m_waiter{executor}
+            , m_registered{false} {}
+
+        // a coroutine destroyed while suspended withdraws its registration
+        ~readiness()
+        {
+            withdraw();
+        }
+
+        // non-copyable
+        readiness(readiness const&)            = delete;
+        readiness& operator=(readiness const&) = delete;
+
+        // non-movable
+        readiness(readiness&&)            = delete;
+        readiness& operator=(readiness&&) = delete;
+
+        auto await_ready() -> bool
+        {
+            return m_ready();
+        }
+
+        auto await_suspend(std::coroutine_handle<> handle) -> bool
+        {
+            // a signal can not resume the coroutine until commit(), so
+            // everything up to and including it may still touch this frame
+            m_waiter.arm(handle);
+            m_registered = true;
+            m_list.add(&m_waiter);
+
+            // pairs with the fence the channel issues before it notifies its
+            // waiters; either the channel observes our registration or we
+            // observe the channel's new state
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (m_ready())
+            {
+                m_waiter.cancel();
+                return false;
+            }
+
+            // the final access to the frame before it may be resumed elsewhere
+            return m_waiter.commit();
+        }
+
+        auto await_resume() -> void
+        {
+            withdraw();
+        }
+
+    private:
+        auto withdraw() -> void
+        {
+            if (m_registered)
+            {
+                m_list.remove(&m_waiter);
+                m_registered = false;
+            }
+        }
+    };
+}
+
+#endif // WMP_HAS_COROUTINES
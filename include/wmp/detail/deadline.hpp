@@ -0,0 +1,103 @@
+// deadline.hpp
+//
+// An absolute point on the steady clock by which a wait must complete.
+//
+// Every blocking operation converts its timeout (relative or absolute) to a
+// deadline once, on entry, and every wait inside the operation sleeps only
+// for the time remaining until it; a spurious wakeup therefore never
+// restarts the timeout, and a timeout is never rounded to whole milliseconds
+// on platforms whose waits accept finer resolution.
+
+#pragma once
+
+#include <chrono>
+#include <type_traits>
+
+namespace wmp::detail
+{
+    class deadline
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        clock::time_point m_at;
+
+    public:
+        constexpr explicit deadline(clock::time_point const at) noexcept
+            : m_at{at} {}
+
+        // never() - a deadline that never expires
+        constexpr static auto never() noexcept -> deadline
+        {
+            return deadline{clock::time_point::max()};
+        }
+
+        // after() - the deadline `timeout` from now
+        //
+        // A timeout too long to represent never expires.
+        template <typename Rep, typename Period>
+        static auto after(std::chrono::duration<Rep, Period> const timeout) -> deadline
+        {
+            using namespace std::chrono;
+
+            auto const now = clock::now();
+            if (timeout <= duration<Rep, Period>::zero())
+            {
+                return deadline{now};
+            }
+
+            // compare in the caller's units, which cannot overflow
+            // for the range a steady clock time_point can represent
+            auto const limit = duration_cast<duration<Rep, Period>>(clock::time_point::max() - now);
+            if (timeout >= limit)
+            {
+                return never();
+            }
+
+            return deadline{now + ceil<clock::duration>(timeout)};
+        }
+
+        // at() - the deadline at `when`, measured on any clock
+        template <typename Clock, typename Duration>
+        static auto at(std::chrono::time_point<Clock, Duration> const& when) -> deadline
+        {
+            using namespace std::chrono;
+
+            if constexpr (std::is_same_v<Clock, clock>)
+            {
+                return deadline{time_point_cast<clock::duration>(when)};
+            }
+            else
+            {
+                // other clocks (e.g. system_clock) may be adjusted; the
+                // deadline tracks the duration until `when` as of now
+                return after(when - Clock::now());
+            }
+        }
+
+        auto is_never() const noexcept -> bool
+        {
+            return clock::time_point::max() == m_at;
+        }
+
+        auto expired() const noexcept -> bool
+        {
+            return !is_never() && clock::now() >= m_at;
+        }
+
+        // remaining() - the time left until the deadline; zero once it has passed
+        auto remaining() const noexcept -> std::chrono::nanoseconds
+        {
+            if (is_never())
+            {
+                return std::chrono::nanoseconds::max();
+            }
+
+            auto const left = m_at - clock::now();
+            return left > clock::duration::zero()
+                ? std::chrono::duration_cast<std::chrono::nanoseconds>(left)
+                : std::chrono::nanoseconds::zero();
+        }
+    };
+}
@@ -0,0 +1,118 @@
+// event.hpp
+//
+// A sleeper-counted wait point for any number of parked threads.
+//
+// Waiters park on a 32-bit epoch word with wait_on_address(); notifiers
+// bump the epoch and wake only while the sleeper count is nonzero, so an
+// event that nobody waits on costs a fence and a load to notify.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "spin.hpp"
+#include "backend.hpp"
+
+namespace wmp::detail
+{
+    class event
+    {
+        std::atomic<uint32_t> m_epoch;
+        std::atomic<uint32_t> m_sleepers;
+
+    public:
+        event() noexcept
+            : m_epoch{0}
+            , m_sleepers{0} {}
+
+        // non-copyable
+        event(event const&)            = delete;
+        event& operator=(event const&) = delete;
+
+        // non-movable
+        event(event&&)            = delete;
+        event& operator=(event&&) = delete;
+
+        // notify_one() - wake a single parked waiter, if any
+        auto notify_one() noexcept -> void
+        {
+            if (has_sleepers())
+            {
+                m_epoch.fetch_add(1, std::memory_order_relaxed);
+                wake_address_one(m_epoch);
+            }
+        }
+
+        // notify_all() - wake every parked waiter, if any
+        auto notify_all() noexcept -> void
+        {
+            if (has_sleepers())
+            {
+                m_epoch.fetch_add(1, std::memory_order_relaxed);
+                wake_address_all(m_epoch);
+            }
+        }
+
+        // await() - invoke `attempt` until it reports success or the deadline passes
+        //
+        // Spins briefly, then parks between attempts. Returns the result of
+        // the final attempt.
+        template <typename Attempt>
+        auto await(Attempt&& attempt, deadline const until) -> bool
+        {
+            return await(
+                std::forward<Attempt>(attempt),
+                until,
+                [](auto&& wait) { return wait(); });
+        }
+
+        // await() - as above, with every park made through `park(wait)`
+        //
+        // `park` must invoke `wait` exactly once and return its result;
+        // it lets the caller observe (e.g. count and time) each park.
+        template <typename Attempt, typename Park>
+        auto await(Attempt&& attempt, deadline const until, Park&& park) -> bool
+        {
+            for (auto spins = 0u; spins < SPIN_LIMIT; ++spins)
+            {
+                if (attempt())
+                {
+                    return true;
+                }
+                cpu_relax();
+            }
+
+            for (;;)
+            {
+                auto const epoch = m_epoch.load(std::memory_order_relaxed);
+                m_sleepers.fetch_add(1, std::memory_order_relaxed);
+
+                // pairs with the fence in has_sleepers(); either the notifier
+                // observes this sleeper or the attempt observes whatever the
+                // notifier published
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (attempt())
+                {
+                    m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                auto const woken = park([&]() { return wait_on_address(m_epoch, epoch, until); });
+                m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+                if (!woken)
+                {
+                    return attempt();
+                }
+            }
+        }
+
+    private:
+        auto has_sleepers() noexcept -> bool
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return m_sleepers.load(std::memory_order_relaxed) != 0;
+        }
+    };
+}
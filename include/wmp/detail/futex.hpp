@@ -0,0 +1,59 @@
+// futex.hpp
+//
+// Thin wrappers around the raw futex(2) system call.
+
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+
+namespace wmp::detail
+{
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+    // futex_wait() - sleep while `*word` holds `expected`
+    //
+    // Returns `false` only when the (relative) timeout expired; a wake,
+    // a spurious wakeup, an interrupt, or a mismatched value all return
+    // `true` and the caller is expected to re-check its predicate.
+    inline auto futex_wait(
+        std::atomic<uint32_t>*  word,
+        uint32_t const          expected,
+        struct timespec const*  timeout = nullptr) noexcept -> bool
+    {
+        auto const r = ::syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(word),
+            FUTEX_WAIT_PRIVATE,
+            expected,
+            timeout,
+            nullptr,
+            0);
+        return !(r == -1 && ETIMEDOUT == errno);
+    }
+
+    // futex_wake() - wake up to `count` threads sleeping on `word`
+    inline auto futex_wake(std::atomic<uint32_t>* word, int const count) noexcept -> void
+    {
+        ::syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(word),
+            FUTEX_WAKE_PRIVATE,
+            count,
+            nullptr,
+            nullptr,
+            0);
+    }
+
+    inline auto futex_wake_all(std::atomic<uint32_t>* word) noexcept -> void
+    {
+        futex_wake(word, INT_MAX);
+    }
+}
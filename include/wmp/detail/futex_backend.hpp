@@ -0,0 +1,383 @@
+// futex_backend.hpp
+//
+// Synchronization backend built directly on futex(2).
+//
+// srw_lock packs the entire lock state into a single 32-bit word so that an
+// uncontended acquire or release costs exactly one atomic read-modify-write;
+// the kernel is entered only when a thread must actually park, or when a
+// release observes that some thread is parked.
+
+#pragma once
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <cerrno>
+#include <atomic>
+#include <cstdint>
+#include <system_error>
+
+#include "futex.hpp"
+#include "spin.hpp"
+#include "trace.hpp"
+#include "deadline.hpp"
+#include "srw_acquire.hpp"
+#include "wake_counter.hpp"
+
+namespace wmp::detail
+{
+    // ------------------------------------------------------------------------
+    // address waiting
+
+    // wait_on_address() - sleep while `word` holds `expected`
+    //
+    // Returns `false` if the deadline passed; spurious returns are possible
+    // and callers are expected to re-check the word.
+    inline auto wait_on_address(
+        std::atomic<uint32_t>& word,
+        uint32_t const         expected,
+        deadline const         until = deadline::never()) noexcept -> bool
+    {
+        if (until.is_never())
+        {
+            return trace_block(&word, [&]() { return futex_wait(&word, expected); });
+        }
+
+        auto const remaining = until.remaining().count();
+        if (0 == remaining)
+        {
+            return false;
+        }
+
+        auto const timeout = timespec{
+            static_cast<time_t>(remaining / 1000000000),
+            static_cast<long>(remaining % 1000000000)};
+        return trace_block(&word, [&]() { return futex_wait(&word, expected, &timeout); });
+    }
+
+    inline auto wake_address_one(std::atomic<uint32_t>& word) noexcept -> void
+    {
+        count_wake();
+        trace_event(trace_kind::wake, trace_source::backend, &word);
+        futex_wake(&word, 1);
+    }
+
+    inline auto wake_address_all(std::atomic<uint32_t>& word) noexcept -> void
+    {
+        count_wake();
+        trace_event(trace_kind::wake, trace_source::backend, &word);
+        futex_wake_all(&word);
+    }
+
+    // ------------------------------------------------------------------------
+    // native_event
+
+    // native_event - a manual-reset event backed by an eventfd(2)
+    //
+    // The descriptor is readable while the event is set, so it can be
+    // registered with poll(2) / epoll(7) alongside other descriptors.
+    class native_event
+    {
+        int m_fd;
+
+    public:
+        using native_handle_type = int;
+
+        native_event()
+            : m_fd{::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)}
+        {
+            if (-1 == m_fd)
+            {
+                throw std::system_error{errno, std::system_category(), "eventfd"};
+            }
+        }
+
+        ~native_event()
+        {
+            ::close(m_fd);
+        }
+
+        // non-copyable
+        native_event(native_event const&)            = delete;
+        native_event& operator=(native_event const&) = delete;
+
+        // non-movable
+        native_event(native_event&&)            = delete;
+        native_event& operator=(native_event&&) = delete;
+
+        auto set() noexcept -> void
+        {
+            auto const one = uint64_t{1};
+            [[maybe_unused]] auto const r = ::write(m_fd, &one, sizeof(one));
+        }
+
+        auto reset() noexcept -> void
+        {
+            // the descriptor is non-blocking; a read of an unset event fails harmlessly
+            auto count = uint64_t{0};
+            [[maybe_unused]] auto const r = ::read(m_fd, &count, sizeof(count));
+        }
+
+        auto native_handle() const noexcept -> native_handle_type
+        {
+            return m_fd;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // srw_lock
+
+    class srw_lock
+    {
+        // lock word layout:
+        //  bit 31     - held exclusively by a writer
+        //  bit 30     - one or more threads (may be) parked on the word
+        //  bits 0..29 - number of readers holding the lock in shared mode
+        constexpr static uint32_t const WRITER  = uint32_t{1} << 31;
+        constexpr static uint32_t const WAITERS = uint32_t{1} << 30;
+        constexpr static uint32_t const READERS = WAITERS - 1;
+
+        std::atomic<uint32_t> m_word;
+
+    public:
+        srw_lock() noexcept
+            : m_word{0} {}
+
+        ~srw_lock() = default;
+
+        // non-copyable
+        srw_lock(srw_lock const&)            = delete;
+        srw_lock& operator=(srw_lock const&) = delete;
+
+        // non-movable
+        srw_lock(srw_lock&&)            = delete;
+        srw_lock& operator=(srw_lock&&) = delete;
+
+        auto acquire_exclusive() noexcept -> void
+        {
+            auto expected = uint32_t{0};
+            if (!m_word.compare_exchange_strong(
+                expected, WRITER, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                acquire_exclusive_slow();
+            }
+        }
+
+        auto acquire_shared() noexcept -> void
+        {
+            auto current = m_word.load(std::memory_order_relaxed);
+            if ((current & WRITER) != 0 || !m_word.compare_exchange_strong(
+                current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                acquire_shared_slow();
+            }
+        }
+
+        auto release_exclusive() noexcept -> void
+        {
+            // no readers may be present while a writer holds the lock
+            auto const prev = m_word.exchange(0, std::memory_order_release);
+            if ((prev & WAITERS) != 0)
+            {
+                futex_wake_all(&m_word);
+            }
+        }
+
+        auto release_shared() noexcept -> void
+        {
+            auto const prev = m_word.fetch_sub(1, std::memory_order_release);
+            if ((prev & READERS) == 1 && (prev & WAITERS) != 0)
+            {
+                // last reader out with parked threads; if another thread slips
+                // in ahead of us it inherits the responsibility to wake waiters
+                auto expected = WAITERS;
+                if (m_word.compare_exchange_strong(expected, 0, std::memory_order_relaxed))
+                {
+                    futex_wake_all(&m_word);
+                }
+            }
+        }
+
+    private:
+        auto acquire_exclusive_slow() noexcept -> void
+        {
+            for (auto spins = 0u; spins < SPIN_LIMIT; ++spins)
+            {
+                auto current = m_word.load(std::memory_order_relaxed);
+                if ((current & (WRITER | READERS)) == 0 && m_word.compare_exchange_weak(
+                    current, current | WRITER, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return;
+                }
+                cpu_relax();
+            }
+
+            for (;;)
+            {
+                auto current = m_word.load(std::memory_order_relaxed);
+                if ((current & (WRITER | READERS)) == 0)
+                {
+                    // we may have been one of several parked threads, so
+                    // conservatively keep the WAITERS bit set on acquisition
+                    if (m_word.compare_exchange_weak(
+                        current, WRITER | WAITERS, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                    continue;
+                }
+
+                if ((current & WAITERS) == 0 && !m_word.compare_exchange_weak(
+                    current, current | WAITERS, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                futex_wait(&m_word, current | WAITERS);
+            }
+        }
+
+        auto acquire_shared_slow() noexcept -> void
+        {
+            for (auto spins = 0u; spins < SPIN_LIMIT; ++spins)
+            {
+                auto current = m_word.load(std::memory_order_relaxed);
+                if ((current & WRITER) == 0 && m_word.compare_exchange_weak(
+                    current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return;
+                }
+                cpu_relax();
+            }
+
+            for (;;)
+            {
+                auto current = m_word.load(std::memory_order_relaxed);
+                if ((current & WRITER) == 0)
+                {
+                    if (m_word.compare_exchange_weak(
+                        current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                    continue;
+                }
+
+                if ((current & WAITERS) == 0 && !m_word.compare_exchange_weak(
+                    current, current | WAITERS, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                futex_wait(&m_word, current | WAITERS);
+            }
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // cond_var
+
+    class cond_var
+    {
+        // bumped on every wake; sleepers park on this word
+        std::atomic<uint32_t> m_seq;
+        // number of threads currently inside sleep()
+        std::atomic<uint32_t> m_sleepers;
+
+    public:
+        cond_var() noexcept
+            : m_seq{0}
+            , m_sleepers{0} {}
+
+        ~cond_var() = default;
+
+        // non-copyable
+        cond_var(cond_var const&)            = delete;
+        cond_var& operator=(cond_var const&) = delete;
+
+        // non-movable
+        cond_var(cond_var&&)            = delete;
+        cond_var& operator=(cond_var&&) = delete;
+
+        // sleep() - atomically release `lock` and wait for a wake
+        //
+        // The lock must be held with the specified ownership on entry and
+        // is held with the same ownership on exit. Returns `false` if the
+        // deadline passed before the thread was woken.
+        auto sleep(
+            srw_lock&           lock,
+            srw_acquire const   ownership,
+            deadline const      until = deadline::never()) noexcept -> bool
+        {
+            auto const seq = m_seq.load(std::memory_order_relaxed);
+            m_sleepers.fetch_add(1);
+
+            release(lock, ownership);
+
+            // spin briefly on the sequence word before paying for a park
+            for (auto spins = 0u; spins < SPIN_LIMIT && m_seq.load(std::memory_order_acquire) == seq; ++spins)
+            {
+                cpu_relax();
+            }
+
+            auto woken = true;
+            if (m_seq.load(std::memory_order_acquire) == seq)
+            {
+                woken = wait_on_address(m_seq, seq, until);
+            }
+
+            m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+
+            acquire(lock, ownership);
+            return woken;
+        }
+
+        auto wake_one() noexcept -> void
+        {
+            count_wake();
+            m_seq.fetch_add(1);
+            if (m_sleepers.load() != 0)
+            {
+                trace_event(trace_kind::wake, trace_source::backend, &m_seq);
+                futex_wake(&m_seq, 1);
+            }
+        }
+
+        auto wake_all() noexcept -> void
+        {
+            count_wake();
+            m_seq.fetch_add(1);
+            if (m_sleepers.load() != 0)
+            {
+                trace_event(trace_kind::wake, trace_source::backend, &m_seq);
+                futex_wake_all(&m_seq);
+            }
+        }
+
+    private:
+        static auto acquire(srw_lock& lock, srw_acquire const ownership) noexcept -> void
+        {
+            if (srw_acquire::exclusive == ownership)
+            {
+                lock.acquire_exclusive();
+            }
+            else
+            {
+                lock.acquire_shared();
+            }
+        }
+
+        static auto release(srw_lock& lock, srw_acquire const ownership) noexcept -> void
+        {
+            if (srw_acquire::exclusive == ownership)
+            {
+                lock.release_exclusive();
+            }
+            else
+            {
+                lock.release_shared();
+            }
+        }
+    };
+}
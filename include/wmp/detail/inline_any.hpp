@@ -0,0 +1,232 @@
+// inline_any.hpp
+//
+// A move-only container for a single value of any type, stored in place
+// when it fits.
+//
+// A value whose type is at most `MaxInlineSize` bytes, no more aligned
+// than std::max_align_t and nothrow move constructible is constructed
+// directly in the container's own storage; any other value is allocated on
+// the heap and the container holds a pointer to it. Each stored type is
+// identified by the address of a table of the operations on it (its tag),
+// so testing for a type is a single pointer comparison and moving or
+// destroying the value a single indirect call; no virtual functions or
+// RTTI are involved.
+
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace wmp::detail
+{
+    template <std::size_t MaxInlineSize>
+    class inline_any
+    {
+        static_assert(MaxInlineSize >= sizeof(void*), "inline storage must at least hold a pointer");
+
+        // the operations on a stored type; its address is the type's tag
+        struct ops
+        {
+            // move the value in `src` into the empty storage `dst`, destroying `src`
+            void (*relocate)(void* dst, void* src) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename M>
+        constexpr static bool const fits_inline =
+            sizeof(M) <= MaxInlineSize &&
+            alignof(M) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<M>;
+
+        template <typename M>
+        struct inline_ops
+        {
+            static auto relocate(void* dst, void* src) noexcept -> void
+            {
+                auto* value = std::launder(static_cast<M*>(src));
+                ::new (dst) M(std::move(*value));
+                value->~M();
+            }
+
+            static auto destroy(void* storage) noexcept -> void
+            {
+                std::launder(static_cast<M*>(storage))->~M();
+            }
+
+            constexpr static ops const table = {&relocate, &destroy};
+        };
+
+        template <typename M>
+        struct heap_ops
+        {
+            static auto relocate(void* dst, void* src) noexcept -> void
+            {
+                ::new (dst) M*(*static_cast<M**>(src));
+            }
+
+            static auto destroy(void* storage) noexcept -> void
+            {
+                delete *static_cast<M**>(storage);
+            }
+
+            constexpr static ops const table = {&relocate, &destroy};
+        };
+
+        template <typename M>
+        constexpr static auto tag() noexcept -> ops const*
+        {
+            if constexpr (fits_inline<M>)
+            {
+                return &inline_ops<M>::table;
+            }
+            else
+            {
+                return &heap_ops<M>::table;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char m_storage[MaxInlineSize];
+        // nullptr when empty
+        ops const* m_ops;
+
+    public:
+        constexpr static std::size_t const max_inline_size = MaxInlineSize;
+
+        inline_any() noexcept
+            : m_ops{nullptr} {}
+
+        // holds a value of type M constructed in place from `args`
+        template <typename M, typename... Args>
+        explicit inline_any(std::in_place_type_t<M>, Args&&... args)
+            : m_ops{nullptr}
+        {
+            static_assert(std::is_same_v<M, std::decay_t<M>>, "stored types must be object types");
+
+            if constexpr (fits_inline<M>)
+            {
+                ::new (static_cast<void*>(m_storage)) M(std::forward<Args>(args)...);
+            }
+            else
+            {
+                ::new (static_cast<void*>(m_storage)) M*(new M(std::forward<Args>(args)...));
+            }
+            m_ops = tag<M>();
+        }
+
+        // holds `value`, moved or copied in; implicit, so that any message can be sent as is
+        template <typename U, typename = std::enable_if_t<!std::is_same_v<std::decay_t<U>, inline_any>>>
+        inline_any(U&& value)
+            : inline_any{std::in_place_type<std::decay_t<U>>, std::forward<U>(value)} {}
+
+        ~inline_any()
+        {
+            reset();
+        }
+
+        // non-copyable
+        inline_any(inline_any const&)            = delete;
+        inline_any& operator=(inline_any const&) = delete;
+
+        // leaves `other` empty
+        inline_any(inline_any&& other) noexcept
+            : m_ops{nullptr}
+        {
+            take(other);
+        }
+
+        // leaves `other` empty
+        inline_any& operator=(inline_any&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+
+        auto has_value() const noexcept -> bool
+        {
+            return m_ops != nullptr;
+        }
+
+        // is() - whether the value held is of type M
+        template <typename M>
+        auto is() const noexcept -> bool
+        {
+            return tag<M>() == m_ops;
+        }
+
+        // stored_inline() - whether a value of type M is held in place rather than on the heap
+        template <typename M>
+        constexpr static auto stored_inline() noexcept -> bool
+        {
+            return fits_inline<M>;
+        }
+
+        // get() - the value held, which must be of type M
+        template <typename M>
+        auto get() noexcept -> M&
+        {
+            if constexpr (fits_inline<M>)
+            {
+                return *std::launder(reinterpret_cast<M*>(m_storage));
+            }
+            else
+            {
+                return **std::launder(reinterpret_cast<M**>(m_storage));
+            }
+        }
+
+        // get_if() - the value held if it is of type M, otherwise nullptr
+        template <typename M>
+        auto get_if() noexcept -> M*
+        {
+            return is<M>() ? &get<M>() : nullptr;
+        }
+
+        // visit() - invoke `visitor` on the value held if it is one of Ms
+        //
+        // The candidate types are tried in order, each with one comparison of
+        // the tag. Returns whether the visitor was invoked.
+        template <typename... Ms, typename Visitor>
+        auto visit(Visitor&& visitor) -> bool
+        {
+            return (try_visit<Ms>(visitor) || ...);
+        }
+
+        // reset() - destroy the value held, if any
+        auto reset() noexcept -> void
+        {
+            if (m_ops)
+            {
+                m_ops->destroy(m_storage);
+                m_ops = nullptr;
+            }
+        }
+
+    private:
+        template <typename M, typename Visitor>
+        auto try_visit(Visitor& visitor) -> bool
+        {
+            if (!is<M>())
+            {
+                return false;
+            }
+
+            visitor(get<M>());
+            return true;
+        }
+
+        auto take(inline_any& other) noexcept -> void
+        {
+            if (other.m_ops)
+            {
+                other.m_ops->relocate(m_storage, other.m_storage);
+                m_ops = std::exchange(other.m_ops, nullptr);
+            }
+        }
+    };
+}
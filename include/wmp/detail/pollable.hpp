@@ -0,0 +1,83 @@
+// pollable.hpp
+//
+// A receiver's readiness mirrored onto a native_event.
+//
+// A pollable is a waiter that stays registered with its channel for as long
+// as it lives. A channel signal sets the event only if it is not already
+// set, so a stream of sends into a non-empty channel costs no system call;
+// the receiver re-arms the event once it observes the channel idle, and
+// once right after creating the pollable, to account for earlier sends.
+
+#pragma once
+
+#include <atomic>
+
+#include "backend.hpp"
+#include "waiter.hpp"
+
+namespace wmp::detail
+{
+    class pollable : public waiter
+    {
+        waiter_list&      m_list;
+        native_event      m_event;
+
+        // mirrors the state of m_event, without a system call; starts out
+        // set so that the owner's first rearm() checks the channel
+        std::atomic<bool> m_set;
+
+    public:
+        explicit pollable(waiter_list& list)
+            : waiter{&signal}
+            , m_list{list}
+            , m_event{}
+            , m_set{true}
+        {
+            m_list.add(this);
+        }
+
+        ~pollable()
+        {
+            m_list.remove(this);
+        }
+
+        auto native_handle() const noexcept -> native_event::native_handle_type
+        {
+            return m_event.native_handle();
+        }
+
+        // rearm() - clear the event after the receiver has found its channel idle
+        //
+        // `ready` re-checks the channel after the event is cleared, so that
+        // a signal absorbed while the event was still set is not lost.
+        template <typename Ready>
+        auto rearm(Ready&& ready) -> void
+        {
+            if (!m_set.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            m_event.reset();
+
+            // acquire pairs with the signal that set the event, and the fence
+            // with the one the channel issues before it notifies its waiters
+            m_set.exchange(false, std::memory_order_acq_rel);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ready())
+            {
+                signal(*this);
+            }
+        }
+
+    private:
+        static auto signal(waiter& w) noexcept -> void
+        {
+            auto& self = static_cast<pollable&>(w);
+            if (!self.m_set.exchange(true, std::memory_order_acq_rel))
+            {
+                self.m_event.set();
+            }
+        }
+    };
+}
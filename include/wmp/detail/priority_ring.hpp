@@ -0,0 +1,253 @@
+// priority_ring.hpp
+//
+// A bounded, multiple-producer single-consumer buffer with `Levels`
+// priority levels, each a bounded_ring of its own.
+//
+// A word with one bit per level records which levels may hold values, so
+// the consumer finds the highest non-empty level with a single load and a
+// bit scan, however many levels there are. Producers set a level's bit
+// after publishing a value to it; the consumer clears the bit when it finds
+// the level empty, and then looks again in case a producer published in
+// between (each side issues a fence between its store and its load, so at
+// least one of them observes the other). A bit may therefore briefly be set
+// for an empty level, but is never clear for a level holding a published
+// value.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <optional>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "bounded_ring.hpp"
+
+namespace wmp::detail
+{
+    // highest_bit() - the index of the most significant set bit of a nonzero word
+    inline auto highest_bit(uint64_t const word) noexcept -> std::size_t
+    {
+#if defined(_MSC_VER)
+        auto index = 0ul;
+        _BitScanReverse64(&index, word);
+        return static_cast<std::size_t>(index);
+#else
+        return static_cast<std::size_t>(63 - __builtin_clzll(word));
+#endif
+    }
+
+    template <typename T, std::size_t Levels>
+    class priority_ring
+    {
+        static_assert(Levels > 0 && Levels <= 64, "a priority_ring has between 1 and 64 levels");
+
+        std::array<bounded_ring<T>, Levels> m_levels;
+        std::atomic<uint64_t>               m_occupied;
+
+    public:
+        constexpr static bool const is_bounded = true;
+
+        constexpr static std::size_t const levels = Levels;
+
+        // producer - a sender's view of the buffer, able to push at any level
+        //
+        // Values pushed without a level are pushed at the lowest, level 0;
+        // levels above the highest are pushed at the highest.
+        class producer
+        {
+            priority_ring* m_buffer;
+
+        public:
+            explicit producer(priority_ring& buffer) noexcept
+                : m_buffer{&buffer} {}
+
+            template <typename U>
+            auto try_push(U&& value) -> bool
+            {
+                return m_buffer->try_push(0, std::forward<U>(value));
+            }
+
+            template <typename U>
+            auto try_push(std::size_t const level, U&& value) -> bool
+            {
+                return m_buffer->try_push(std::min(level, Levels - 1), std::forward<U>(value));
+            }
+
+            template <typename... Args>
+            auto try_emplace(Args&&... args) -> bool
+            {
+                return m_buffer->try_emplace(0, std::forward<Args>(args)...);
+            }
+
+            template <typename ForwardIt>
+            auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+            {
+                return m_buffer->try_push_many(0, first, last);
+            }
+
+            // full() - whether try_push() would fail at the lowest level
+            auto full() const noexcept -> bool
+            {
+                return m_buffer->m_levels[0].size() >= m_buffer->m_levels[0].capacity();
+            }
+        };
+
+        // every level has room for `capacity` values, rounded up to the next power of two
+        explicit priority_ring(std::size_t const capacity)
+            : priority_ring{capacity, std::make_index_sequence<Levels>{}} {}
+
+        // non-copyable
+        priority_ring(priority_ring const&)            = delete;
+        priority_ring& operator=(priority_ring const&) = delete;
+
+        // non-movable
+        priority_ring(priority_ring&&)            = delete;
+        priority_ring& operator=(priority_ring&&) = delete;
+
+        // try_push() - attempt to enqueue a value at `level`, safe for concurrent producers
+        template <typename U>
+        auto try_push(std::size_t const level, U&& value) -> bool
+        {
+            return try_emplace(level, std::forward<U>(value));
+        }
+
+        // try_emplace() - attempt to construct a value in place at `level`
+        template <typename... Args>
+        auto try_emplace(std::size_t const level, Args&&... args) -> bool
+        {
+            if (!m_levels[level].try_emplace(std::forward<Args>(args)...))
+            {
+                return false;
+            }
+
+            mark(level);
+            return true;
+        }
+
+        // try_push_many() - enqueue a prefix of [first, last) at `level`
+        template <typename ForwardIt>
+        auto try_push_many(std::size_t const level, ForwardIt first, ForwardIt last) -> ForwardIt
+        {
+            auto const next = m_levels[level].try_push_many(first, last);
+            if (next != first)
+            {
+                mark(level);
+            }
+            return next;
+        }
+
+        // try_pop() - dequeue a value from the highest non-empty level;
+        // must only be called by the consumer
+        auto try_pop() -> std::optional<T>
+        {
+            auto occupied = m_occupied.load(std::memory_order_acquire);
+            while (occupied)
+            {
+                auto const level = highest_bit(occupied);
+                if (auto value = m_levels[level].try_pop(); value.has_value())
+                {
+                    return value;
+                }
+
+                unmark(level);
+                occupied &= ~(uint64_t{1} << level);
+            }
+
+            return std::nullopt;
+        }
+
+        // try_pop_many() - dequeue up to `max` values, highest levels first;
+        // must only be called by the consumer
+        template <typename OutputIt>
+        auto try_pop_many(OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            auto count    = std::size_t{0};
+            auto occupied = m_occupied.load(std::memory_order_acquire);
+            while (occupied && count < max)
+            {
+                auto const level = highest_bit(occupied);
+                count += m_levels[level].try_pop_many(out, max - count);
+                if (count < max)
+                {
+                    unmark(level);
+                }
+                occupied &= ~(uint64_t{1} << level);
+            }
+
+            return count;
+        }
+
+        // empty() - whether try_pop() would fail; must only be called by the consumer
+        auto empty() const noexcept -> bool
+        {
+            auto occupied = m_occupied.load(std::memory_order_acquire);
+            while (occupied)
+            {
+                auto const level = highest_bit(occupied);
+                if (!m_levels[level].empty())
+                {
+                    return false;
+                }
+                occupied &= ~(uint64_t{1} << level);
+            }
+            return true;
+        }
+
+        // size() - approximate number of values currently enqueued, across every level
+        auto size() const noexcept -> std::size_t
+        {
+            auto total = std::size_t{0};
+            for (auto const& level : m_levels)
+            {
+                total += level.size();
+            }
+            return total;
+        }
+
+        // capacity() - the capacity of each level
+        auto capacity() const noexcept -> std::size_t
+        {
+            return m_levels[0].capacity();
+        }
+
+    private:
+        template <std::size_t... I>
+        priority_ring(std::size_t const capacity, std::index_sequence<I...>)
+            : m_levels{{ (static_cast<void>(I), bounded_ring<T>{capacity})... }}
+            , m_occupied{0} {}
+
+        // mark() - record that `level` holds a published value
+        auto mark(std::size_t const level) noexcept -> void
+        {
+            auto const bit = uint64_t{1} << level;
+
+            // pairs with the fence in unmark(): either this load observes
+            // the consumer's clear, or the consumer observes the value
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (0 == (m_occupied.load(std::memory_order_relaxed) & bit))
+            {
+                m_occupied.fetch_or(bit, std::memory_order_release);
+            }
+        }
+
+        // unmark() - clear the bit of a level found empty, unless a value has since arrived
+        auto unmark(std::size_t const level) noexcept -> void
+        {
+            auto const bit = uint64_t{1} << level;
+
+            m_occupied.fetch_and(~bit, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!m_levels[level].empty())
+            {
+                m_occupied.fetch_or(bit, std::memory_order_relaxed);
+            }
+        }
+    };
+}
@@ -2,29 +2,28 @@
 
 #pragma once
 
-#include <windows.h>
-
+#include "backend.hpp"
 #include "srw_acquire.hpp"
 
 namespace wmp::detail
 {
     class scoped_srw
     {
-        PSRWLOCK    m_lock;
+        srw_lock*   m_lock;
         srw_acquire m_ownership;
 
     public:
-        scoped_srw(PSRWLOCK lock, srw_acquire ownership)
+        scoped_srw(srw_lock* lock, srw_acquire ownership)
             : m_lock{lock}
             , m_ownership{ownership}
         {
             if (srw_acquire::exclusive == m_ownership)
             {
-                ::AcquireSRWLockExclusive(m_lock);
+                m_lock->acquire_exclusive();
             }
             else
             {
-                AcquireSRWLockShared(m_lock);
+                m_lock->acquire_shared();
             }
         }
 
@@ -44,11 +43,11 @@ namespace wmp::detail
         {
             if (srw_acquire::exclusive == m_ownership)
             {
-                ::ReleaseSRWLockExclusive(m_lock);
+                m_lock->release_exclusive();
             }
             else
             {
-                ::ReleaseSRWLockShared(m_lock);
+                m_lock->release_shared();
             }
         }
     };
@@ -0,0 +1,329 @@
+// segmented_queue.hpp
+//
+// An unbounded, multiple-producer single-consumer queue built from
+// fixed-size segments that are drawn from, and returned to, a slab_pool.
+//
+// Producers claim positions with a CAS on a single tail index, whose low
+// part is the offset of the position within the current segment. Claiming
+// the last slot of a segment makes the claiming producer responsible for
+// linking the next one: while it does, the tail index holds the otherwise
+// unused offset SEGMENT_CAPACITY and other producers wait. A claimed slot
+// is published with a release store of its `ready` flag; should the
+// value's constructor throw, the slot is published vacant instead, and the
+// consumer steps over it.
+//
+// The single consumer follows the segments, and returns each to the pool
+// as soon as it has taken the value in its last slot, so a queue holds only
+// the segments between its oldest and newest values: after a burst it
+// shrinks back to a single segment. When many queues share a pool, the
+// memory of a burst on one is available to the bursts of all the others.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <type_traits>
+
+#include "spin.hpp"
+#include "cache_line.hpp"
+#include "slab_pool.hpp"
+
+namespace wmp::detail
+{
+    // number of values held by each segment of a segmented_queue
+    constexpr static std::size_t const SEGMENT_CAPACITY = 31;
+
+    template <typename T>
+    class segmented_queue
+    {
+        // the tail index advances by LAP per segment; offset SEGMENT_CAPACITY
+        // marks a segment whose successor is being linked
+        constexpr static uint64_t const LAP = SEGMENT_CAPACITY + 1;
+
+        // states of a slot's `ready` flag
+        constexpr static uint32_t const EMPTY  = 0;
+        constexpr static uint32_t const FULL   = 1;
+        constexpr static uint32_t const VACANT = 2;
+
+        struct slot
+        {
+            std::atomic<uint32_t> ready;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            auto value() noexcept -> T*
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        struct segment
+        {
+            std::atomic<segment*> next;
+            slot                  slots[SEGMENT_CAPACITY];
+
+            segment() noexcept
+                : next{nullptr}
+            {
+                for (auto& s : slots)
+                {
+                    s.ready.store(EMPTY, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        // claimed by producers
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_tail;
+        std::atomic<segment*> m_tail_segment;
+
+        // consumer only
+        alignas(CACHE_LINE_SIZE) uint64_t m_head;
+        segment* m_head_segment;
+
+        alignas(CACHE_LINE_SIZE) slab_pool* const m_pool;
+        // segments currently held, for footprint()
+        std::atomic<std::size_t> m_segments;
+
+    public:
+        constexpr static bool const is_bounded = false;
+
+        // segments are allocated from, and released to, `pool`, which must outlive the queue
+        explicit segmented_queue(slab_pool& pool)
+            : m_tail{0}
+            , m_tail_segment{nullptr}
+            , m_head{0}
+            , m_head_segment{nullptr}
+            , m_pool{&pool}
+            , m_segments{0}
+        {
+            m_head_segment = allocate();
+            m_tail_segment.store(m_head_segment, std::memory_order_relaxed);
+        }
+
+        ~segmented_queue()
+        {
+            while (try_pop().has_value()) {}
+            release(m_head_segment);
+        }
+
+        // non-copyable
+        segmented_queue(segmented_queue const&)            = delete;
+        segmented_queue& operator=(segmented_queue const&) = delete;
+
+        // non-movable
+        segmented_queue(segmented_queue&&)            = delete;
+        segmented_queue& operator=(segmented_queue&&) = delete;
+
+        // try_push() - enqueue a value, safe for concurrent producers
+        //
+        // Never fails (short of allocation failure); the return value exists
+        // only for interface parity with bounded_ring.
+        template <typename U>
+        auto try_push(U&& value) -> bool
+        {
+            return try_emplace(std::forward<U>(value));
+        }
+
+        // try_emplace() - construct a value in place, safe for concurrent producers
+        template <typename... Args>
+        auto try_emplace(Args&&... args) -> bool
+        {
+            // allocated ahead of the claim of a segment's last slot, so that
+            // other producers wait on the link for as short a time as possible
+            segment* successor = nullptr;
+
+            auto tail = m_tail.load(std::memory_order_acquire);
+            for (;;)
+            {
+                auto const offset = tail % LAP;
+                if (SEGMENT_CAPACITY == offset)
+                {
+                    // another producer is linking the next segment
+                    cpu_relax();
+                    tail = m_tail.load(std::memory_order_acquire);
+                    continue;
+                }
+
+                if (offset + 1 == SEGMENT_CAPACITY && nullptr == successor)
+                {
+                    successor = allocate();
+                }
+
+                // loaded after the index, so at least as recent as it
+                auto* seg = m_tail_segment.load(std::memory_order_acquire);
+                if (!m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_acquire))
+                {
+                    continue;
+                }
+
+                if (offset + 1 == SEGMENT_CAPACITY)
+                {
+                    // link before publishing the last slot: the consumer
+                    // follows `next` once it has taken that slot's value
+                    m_tail_segment.store(successor, std::memory_order_release);
+                    m_tail.store(tail + 2, std::memory_order_release);
+                    seg->next.store(successor, std::memory_order_release);
+                    successor = nullptr;
+                }
+
+                auto& s = seg->slots[offset];
+                if constexpr (std::is_nothrow_constructible_v<T, Args&&...>)
+                {
+                    ::new (static_cast<void*>(s.storage)) T(std::forward<Args>(args)...);
+                }
+                else
+                {
+                    try
+                    {
+                        ::new (static_cast<void*>(s.storage)) T(std::forward<Args>(args)...);
+                    }
+                    catch (...)
+                    {
+                        s.ready.store(VACANT, std::memory_order_release);
+                        if (successor)
+                        {
+                            release(successor);
+                        }
+                        throw;
+                    }
+                }
+                s.ready.store(FULL, std::memory_order_release);
+                break;
+            }
+
+            if (successor)
+            {
+                release(successor);
+            }
+            return true;
+        }
+
+        // try_push_many() - enqueue all of [first, last)
+        //
+        // Values are constructed from `*first`; pass move iterators to move them in.
+        template <typename ForwardIt>
+        auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+        {
+            for (; first != last; ++first)
+            {
+                try_emplace(*first);
+            }
+            return first;
+        }
+
+        // try_pop() - attempt to dequeue a value; must only be called by the consumer
+        //
+        // May transiently report an empty queue while a producer is between
+        // its claim and its publish; that producer notifies after publishing.
+        auto try_pop() -> std::optional<T>
+        {
+            for (;;)
+            {
+                auto& s = m_head_segment->slots[m_head % LAP];
+
+                auto const ready = s.ready.load(std::memory_order_acquire);
+                if (EMPTY == ready)
+                {
+                    return std::nullopt;
+                }
+                else if (VACANT == ready)
+                {
+                    advance();
+                    continue;
+                }
+
+                auto value = std::optional<T>{std::move(*s.value())};
+                s.value()->~T();
+                advance();
+                return value;
+            }
+        }
+
+        // empty() - whether try_pop() would fail; must only be called by the consumer
+        auto empty() const noexcept -> bool
+        {
+            auto const* seg = m_head_segment;
+            for (auto head = m_head;;)
+            {
+                auto const ready = seg->slots[head % LAP].ready.load(std::memory_order_acquire);
+                if (VACANT != ready)
+                {
+                    return EMPTY == ready;
+                }
+
+                // a segment's successor is linked before its last slot is published
+                if (++head % LAP == SEGMENT_CAPACITY)
+                {
+                    seg = seg->next.load(std::memory_order_acquire);
+                    ++head;
+                }
+            }
+        }
+
+        // try_pop_many() - dequeue up to `max` values; must only be called by the consumer
+        template <typename OutputIt>
+        auto try_pop_many(OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            auto count = std::size_t{0};
+            while (count < max)
+            {
+                auto& s = m_head_segment->slots[m_head % LAP];
+
+                auto const ready = s.ready.load(std::memory_order_acquire);
+                if (EMPTY == ready)
+                {
+                    break;
+                }
+                else if (VACANT == ready)
+                {
+                    advance();
+                    continue;
+                }
+
+                *out = std::move(*s.value());
+                ++out;
+                s.value()->~T();
+                advance();
+                ++count;
+            }
+
+            return count;
+        }
+
+        // footprint() - the number of bytes of segment storage currently held
+        auto footprint() const noexcept -> std::size_t
+        {
+            return m_segments.load(std::memory_order_relaxed) * sizeof(segment);
+        }
+
+    private:
+        // advance() - step past the value just taken, releasing a finished segment
+        auto advance() -> void
+        {
+            if (++m_head % LAP == SEGMENT_CAPACITY)
+            {
+                auto* finished = m_head_segment;
+                m_head_segment = finished->next.load(std::memory_order_acquire);
+                ++m_head;
+                release(finished);
+            }
+        }
+
+        auto allocate() -> segment*
+        {
+            auto* seg = ::new (m_pool->allocate(sizeof(segment), alignof(segment))) segment{};
+            m_segments.fetch_add(1, std::memory_order_relaxed);
+            return seg;
+        }
+
+        auto release(segment* seg) -> void
+        {
+            seg->~segment();
+            m_pool->deallocate(seg, sizeof(segment), alignof(segment));
+            m_segments.fetch_sub(1, std::memory_order_relaxed);
+        }
+    };
+}
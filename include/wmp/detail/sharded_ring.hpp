@@ -0,0 +1,272 @@
+// sharded_ring.hpp
+//
+// A bounded, multiple-producer single-consumer buffer built from one
+// single-producer ring per producer.
+//
+// Every producer handle attached to the buffer owns a sub-queue of its own,
+// so producers never write a cache line that another producer writes and a
+// push costs what an spsc_ring push costs, however many producers there
+// are. The consumer merges the sub-queues round-robin, resuming after the
+// sub-queue it last took a value from: values from a single producer are
+// popped in the order they were pushed, values from different producers
+// are interleaved.
+//
+// Sub-queues live in a list that only ever grows, at its head. A producer
+// that detaches marks its sub-queue closed; once the consumer finds a
+// closed sub-queue drained it marks it free, and the next producer to
+// attach takes it over, so the list is only as long as the largest number
+// of producers ever attached at once.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+
+#include "spsc_ring.hpp"
+
+namespace wmp::detail
+{
+    template <typename T>
+    class sharded_ring
+    {
+        // sub-queue lifecycle: owned -> closed -> free -> owned ...
+        constexpr static uint32_t const OWNED  = 0;
+        constexpr static uint32_t const CLOSED = 1;
+        constexpr static uint32_t const FREE   = 2;
+
+        struct shard
+        {
+            spsc_ring<T>          ring;
+            std::atomic<uint32_t> state;
+            // immutable once the shard is published
+            shard*                next;
+
+            explicit shard(std::size_t const capacity)
+                : ring{capacity}
+                , state{OWNED}
+                , next{nullptr} {}
+        };
+
+        std::atomic<shard*> m_head;
+        std::size_t const   m_capacity;
+
+        // consumer side: the sub-queue from which the next pop starts
+        shard* m_cursor;
+
+    public:
+        constexpr static bool const is_bounded = true;
+
+        // producer - a producer's handle on its own sub-queue
+        //
+        // Movable; the sub-queue is released when the handle is destroyed
+        // or assigned over.
+        class producer
+        {
+            shard* m_shard;
+
+        public:
+            explicit producer(sharded_ring& buffer)
+                : m_shard{buffer.attach()} {}
+
+            ~producer()
+            {
+                release();
+            }
+
+            // non-copyable
+            producer(producer const&)            = delete;
+            producer& operator=(producer const&) = delete;
+
+            producer(producer&& other) noexcept
+                : m_shard{std::exchange(other.m_shard, nullptr)} {}
+
+            producer& operator=(producer&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    m_shard = std::exchange(other.m_shard, nullptr);
+                }
+                return *this;
+            }
+
+            template <typename U>
+            auto try_push(U&& value) -> bool
+            {
+                return m_shard->ring.try_push(std::forward<U>(value));
+            }
+
+            template <typename... Args>
+            auto try_emplace(Args&&... args) -> bool
+            {
+                return m_shard->ring.try_emplace(std::forward<Args>(args)...);
+            }
+
+            template <typename ForwardIt>
+            auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+            {
+                return m_shard->ring.try_push_many(first, last);
+            }
+
+            // full() - whether try_push() would fail
+            auto full() const noexcept -> bool
+            {
+                return m_shard->ring.size() >= m_shard->ring.capacity();
+            }
+
+        private:
+            auto release() noexcept -> void
+            {
+                if (m_shard)
+                {
+                    // publishes every value pushed to the consumer that drains it
+                    m_shard->state.store(CLOSED, std::memory_order_release);
+                    m_shard = nullptr;
+                }
+            }
+        };
+
+        // the requested capacity of each sub-queue is rounded up to the next power of two
+        explicit sharded_ring(std::size_t const capacity)
+            : m_head{nullptr}
+            , m_capacity{capacity}
+            , m_cursor{nullptr} {}
+
+        ~sharded_ring()
+        {
+            auto* s = m_head.load(std::memory_order_acquire);
+            while (s)
+            {
+                delete std::exchange(s, s->next);
+            }
+        }
+
+        // non-copyable
+        sharded_ring(sharded_ring const&)            = delete;
+        sharded_ring& operator=(sharded_ring const&) = delete;
+
+        // non-movable
+        sharded_ring(sharded_ring&&)            = delete;
+        sharded_ring& operator=(sharded_ring&&) = delete;
+
+        // try_pop() - attempt to dequeue a value; must only be called by the consumer
+        auto try_pop() -> std::optional<T>
+        {
+            auto* const start = first();
+            if (nullptr == start)
+            {
+                return std::nullopt;
+            }
+
+            auto* s = start;
+            do
+            {
+                if (auto value = s->ring.try_pop(); value.has_value())
+                {
+                    m_cursor = after(s);
+                    return value;
+                }
+
+                reclaim(*s);
+                s = after(s);
+            } while (s != start);
+
+            return std::nullopt;
+        }
+
+        // try_pop_many() - dequeue up to `max` values; must only be called by the consumer
+        //
+        // Takes a batch from each sub-queue in turn, visiting each at most once.
+        template <typename OutputIt>
+        auto try_pop_many(OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            auto* const start = first();
+            if (nullptr == start)
+            {
+                return 0;
+            }
+
+            auto count = std::size_t{0};
+            auto* s = start;
+            do
+            {
+                count += s->ring.try_pop_many(out, max - count);
+                reclaim(*s);
+                s = after(s);
+            } while (count < max && s != start);
+
+            m_cursor = s;
+            return count;
+        }
+
+        // empty() - whether try_pop() would fail; must only be called by the consumer
+        auto empty() const noexcept -> bool
+        {
+            for (auto* s = m_head.load(std::memory_order_acquire); s; s = s->next)
+            {
+                if (!s->ring.empty())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // size() - approximate number of values currently enqueued, across every sub-queue
+        auto size() const noexcept -> std::size_t
+        {
+            auto total = std::size_t{0};
+            for (auto* s = m_head.load(std::memory_order_acquire); s; s = s->next)
+            {
+                total += s->ring.size();
+            }
+            return total;
+        }
+
+    private:
+        // attach() - take over a free sub-queue, or add a new one
+        auto attach() -> shard*
+        {
+            for (auto* s = m_head.load(std::memory_order_acquire); s; s = s->next)
+            {
+                auto expected = FREE;
+                if (FREE == s->state.load(std::memory_order_relaxed) &&
+                    s->state.compare_exchange_strong(expected, OWNED, std::memory_order_acquire))
+                {
+                    return s;
+                }
+            }
+
+            auto* s = new shard{m_capacity};
+            s->next = m_head.load(std::memory_order_relaxed);
+            while (!m_head.compare_exchange_weak(
+                s->next, s, std::memory_order_release, std::memory_order_relaxed)) {}
+
+            return s;
+        }
+
+        // reclaim() - free a closed sub-queue once it has been drained
+        static auto reclaim(shard& s) noexcept -> void
+        {
+            // the state is examined first: a closed sub-queue receives no further values
+            if (CLOSED == s.state.load(std::memory_order_acquire) && s.ring.empty())
+            {
+                s.state.store(FREE, std::memory_order_release);
+            }
+        }
+
+        auto first() noexcept -> shard*
+        {
+            return m_cursor ? m_cursor : m_head.load(std::memory_order_acquire);
+        }
+
+        // after() - the next sub-queue in round-robin order, wrapping to the head of the list
+        auto after(shard* s) const noexcept -> shard*
+        {
+            return s->next ? s->next : m_head.load(std::memory_order_acquire);
+        }
+    };
+}
@@ -0,0 +1,335 @@
+// slab_pool.hpp
+//
+// A recycling pool of fixed-size blocks, and a standard allocator over it.
+//
+// The pool serves a single block size, fixed by the first allocation it
+// sees; requests of any other size (or over-aligned requests) fall through
+// to the global allocator. Released blocks go to a free list private to the
+// releasing thread, so the steady-state allocate / release path touches no
+// shared memory at all. A thread whose private list grows past a limit
+// moves a batch of blocks to the pool's shared list, from which a thread
+// whose private list runs dry takes a batch in turn.
+//
+// Blocks are plain ::operator new allocations and carry no reference to the
+// pool, so blocks still cached by other threads when a pool is destroyed
+// are simply freed when those threads exit.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "backend.hpp"
+#include "scoped_srw.hpp"
+
+namespace wmp::detail
+{
+    // number of pools for which a thread caches blocks at once
+    constexpr static std::size_t const SLAB_CACHED_POOLS = 8;
+    // blocks cached per thread per pool before a batch is handed back
+    constexpr static std::size_t const SLAB_CACHE_CAPACITY = 256;
+    // blocks moved between a thread's cache and the pool's shared list at once
+    constexpr static std::size_t const SLAB_BATCH = 64;
+
+    class slab_pool
+    {
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        struct cache_entry
+        {
+            uint64_t    owner;
+            free_block* head;
+            std::size_t count;
+        };
+
+        // trivially destructible, so that it remains usable (as `exited`)
+        // by channels destroyed after the thread's cleanup has run
+        struct thread_cache
+        {
+            cache_entry entries[SLAB_CACHED_POOLS];
+            bool        exited;
+        };
+
+        struct thread_cache_guard
+        {
+            thread_cache* cache;
+
+            ~thread_cache_guard()
+            {
+                for (auto& e : cache->entries)
+                {
+                    release(e);
+                }
+                cache->exited = true;
+            }
+        };
+
+        uint64_t const m_id;
+
+        // the size of every pooled block; zero until the first allocation
+        std::atomic<std::size_t> m_block_size;
+
+        // blocks handed between threads; guarded by m_lock
+        srw_lock    m_lock;
+        free_block* m_shared;
+        std::size_t m_shared_count;
+
+    public:
+        slab_pool()
+            : m_id{next_id()}
+            , m_block_size{0}
+            , m_shared{nullptr}
+            , m_shared_count{0} {}
+
+        // every block allocated from the pool must have been released
+        ~slab_pool()
+        {
+            if (auto* cache = local_cache())
+            {
+                if (auto& e = cache->entries[m_id % SLAB_CACHED_POOLS]; e.owner == m_id)
+                {
+                    release(e);
+                }
+            }
+
+            while (auto* b = m_shared)
+            {
+                m_shared = b->next;
+                ::operator delete(b);
+            }
+        }
+
+        // non-copyable
+        slab_pool(slab_pool const&)            = delete;
+        slab_pool& operator=(slab_pool const&) = delete;
+
+        // non-movable
+        slab_pool(slab_pool&&)            = delete;
+        slab_pool& operator=(slab_pool&&) = delete;
+
+        auto allocate(std::size_t const bytes, std::size_t const alignment) -> void*
+        {
+            if (!pooled(bytes, alignment))
+            {
+                return ::operator new(bytes, std::align_val_t{alignment});
+            }
+
+            auto* e = local_entry();
+            if (e != nullptr)
+            {
+                if (nullptr == e->head)
+                {
+                    refill(*e);
+                }
+
+                if (auto* b = e->head)
+                {
+                    e->head = b->next;
+                    --e->count;
+                    return b;
+                }
+            }
+
+            return ::operator new(bytes);
+        }
+
+        auto deallocate(void* p, std::size_t const bytes, std::size_t const alignment) -> void
+        {
+            if (!pooled(bytes, alignment))
+            {
+                ::operator delete(p, std::align_val_t{alignment});
+                return;
+            }
+
+            auto* e = local_entry();
+            if (nullptr == e)
+            {
+                // the calling thread is exiting
+                ::operator delete(p);
+                return;
+            }
+
+            e->head = ::new (p) free_block{e->head};
+            if (++e->count > SLAB_CACHE_CAPACITY)
+            {
+                spill(*e);
+            }
+        }
+
+        // available() - the number of released blocks held for reuse by the
+        // pool's shared list and the calling thread
+        auto available() -> std::size_t
+        {
+            auto total = std::size_t{0};
+            if (auto* e = local_entry())
+            {
+                total += e->count;
+            }
+
+            auto guard = scoped_srw{&m_lock, srw_acquire::shared};
+            return total + m_shared_count;
+        }
+
+        // trim() - return the blocks held for reuse by the pool's shared list
+        // and the calling thread to the heap
+        auto trim() -> void
+        {
+            if (auto* cache = local_cache())
+            {
+                if (auto& e = cache->entries[m_id % SLAB_CACHED_POOLS]; e.owner == m_id)
+                {
+                    release(e);
+                    e.owner = m_id;
+                }
+            }
+
+            auto guard = scoped_srw{&m_lock, srw_acquire::exclusive};
+            while (auto* b = m_shared)
+            {
+                m_shared = b->next;
+                ::operator delete(b);
+            }
+            m_shared_count = 0;
+        }
+
+    private:
+        auto pooled(std::size_t const bytes, std::size_t const alignment) -> bool
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ || bytes < sizeof(free_block))
+            {
+                return false;
+            }
+
+            auto current = m_block_size.load(std::memory_order_relaxed);
+            if (0 == current &&
+                m_block_size.compare_exchange_strong(current, bytes, std::memory_order_relaxed))
+            {
+                return true;
+            }
+
+            return current == bytes;
+        }
+
+        // local_cache() - the calling thread's cache, or nullptr once the thread is exiting
+        static auto local_cache() -> thread_cache*
+        {
+            static thread_local thread_cache       cache{};
+            static thread_local thread_cache_guard guard{&cache};
+
+            return cache.exited ? nullptr : &cache;
+        }
+
+        // local_entry() - the calling thread's cache for this pool, or nullptr once it is exiting
+        auto local_entry() -> cache_entry*
+        {
+            auto* cache = local_cache();
+            if (nullptr == cache)
+            {
+                return nullptr;
+            }
+
+            // direct-mapped; a pool that collides with another evicts its blocks
+            auto& e = cache->entries[m_id % SLAB_CACHED_POOLS];
+            if (e.owner != m_id)
+            {
+                release(e);
+                e.owner = m_id;
+            }
+
+            return &e;
+        }
+
+        // refill() - move a batch from the shared list into `e`
+        auto refill(cache_entry& e) -> void
+        {
+            auto guard = scoped_srw{&m_lock, srw_acquire::exclusive};
+            while (m_shared != nullptr && e.count < SLAB_BATCH)
+            {
+                auto* b = m_shared;
+                m_shared = b->next;
+                --m_shared_count;
+
+                b->next = e.head;
+                e.head  = b;
+                ++e.count;
+            }
+        }
+
+        // spill() - move a batch from `e` to the shared list
+        auto spill(cache_entry& e) -> void
+        {
+            auto guard = scoped_srw{&m_lock, srw_acquire::exclusive};
+            for (auto i = std::size_t{0}; i < SLAB_BATCH && e.head != nullptr; ++i)
+            {
+                auto* b = e.head;
+                e.head = b->next;
+                --e.count;
+
+                b->next  = m_shared;
+                m_shared = b;
+                ++m_shared_count;
+            }
+        }
+
+        // release() - return every block cached in `e` to the heap
+        static auto release(cache_entry& e) -> void
+        {
+            while (auto* b = e.head)
+            {
+                e.head = b->next;
+                ::operator delete(b);
+            }
+
+            e = cache_entry{0, nullptr, 0};
+        }
+
+        static auto next_id() -> uint64_t
+        {
+            static std::atomic<uint64_t> ids{0};
+            return ids.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+    };
+
+    // slab_allocator - a standard allocator drawing from a slab_pool
+    template <typename U>
+    struct slab_allocator
+    {
+        using value_type = U;
+
+        slab_pool* pool;
+
+        explicit slab_allocator(slab_pool* p) noexcept
+            : pool{p} {}
+
+        template <typename V>
+        slab_allocator(slab_allocator<V> const& other) noexcept
+            : pool{other.pool} {}
+
+        auto allocate(std::size_t const n) -> U*
+        {
+            return static_cast<U*>(pool->allocate(n * sizeof(U), alignof(U)));
+        }
+
+        auto deallocate(U* p, std::size_t const n) -> void
+        {
+            pool->deallocate(p, n * sizeof(U), alignof(U));
+        }
+
+        template <typename V>
+        auto operator==(slab_allocator<V> const& other) const noexcept -> bool
+        {
+            return pool == other.pool;
+        }
+
+        template <typename V>
+        auto operator!=(slab_allocator<V> const& other) const noexcept -> bool
+        {
+            return pool != other.pool;
+        }
+    };
+}
@@ -0,0 +1,25 @@
+// spin.hpp
+
+#pragma once
+
+#include <atomic>
+
+namespace wmp::detail
+{
+    // number of busy-wait iterations performed before parking a thread
+    constexpr static unsigned const SPIN_LIMIT = 100;
+
+    // cpu_relax() - hint to the processor that we are in a spin-wait loop
+    inline auto cpu_relax() noexcept -> void
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        ::_mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+}
@@ -0,0 +1,231 @@
+// spsc_ring.hpp
+//
+// A lock-free, bounded, single-producer single-consumer ring buffer.
+//
+// The producer owns the head index and the consumer owns the tail index;
+// each side additionally keeps a private cache of the other side's index
+// and only reloads it when the cached value says the ring is full (for the
+// producer) or empty (for the consumer). Neither side ever executes an
+// atomic read-modify-write, and in steady state each side touches the
+// other's cache line only once per lap rather than once per value.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <iterator>
+#include <algorithm>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+
+#include "cache_line.hpp"
+
+namespace wmp::detail
+{
+    template <typename T>
+    class spsc_ring
+    {
+        struct slot
+        {
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            auto value() noexcept -> T*
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        // producer side: the next position to write, and the last tail observed
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_head;
+        uint64_t m_tail_cache;
+
+        // consumer side: the next position to read, and the last head observed
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_tail;
+        uint64_t m_head_cache;
+
+        // read-only after construction
+        alignas(CACHE_LINE_SIZE) std::unique_ptr<slot[]> m_slots;
+        uint64_t m_mask;
+
+    public:
+        constexpr static bool const is_bounded = true;
+
+        // the requested capacity is rounded up to the next power of two
+        explicit spsc_ring(std::size_t const capacity)
+            : m_head{0}
+            , m_tail_cache{0}
+            , m_tail{0}
+            , m_head_cache{0}
+            , m_slots{}
+            , m_mask{0}
+        {
+            auto size = uint64_t{1};
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+
+            m_mask  = size - 1;
+            m_slots = std::make_unique<slot[]>(size);
+        }
+
+        ~spsc_ring()
+        {
+            while (try_pop().has_value()) {}
+        }
+
+        // non-copyable
+        spsc_ring(spsc_ring const&)            = delete;
+        spsc_ring& operator=(spsc_ring const&) = delete;
+
+        // non-movable
+        spsc_ring(spsc_ring&&)            = delete;
+        spsc_ring& operator=(spsc_ring&&) = delete;
+
+        // try_push() - attempt to enqueue a value; must only be called by the producer
+        template <typename U>
+        auto try_push(U&& value) -> bool
+        {
+            return try_emplace(std::forward<U>(value));
+        }
+
+        // try_emplace() - attempt to construct a value in place; must only be called by the producer
+        template <typename... Args>
+        auto try_emplace(Args&&... args) -> bool
+        {
+            auto const head = m_head.load(std::memory_order_relaxed);
+            if (head - m_tail_cache > m_mask)
+            {
+                m_tail_cache = m_tail.load(std::memory_order_acquire);
+                if (head - m_tail_cache > m_mask)
+                {
+                    return false;
+                }
+            }
+
+            ::new (static_cast<void*>(m_slots[head & m_mask].storage)) T(std::forward<Args>(args)...);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // try_push_many() - enqueue a prefix of [first, last); must only be called by the producer
+        //
+        // Values are constructed from `*first`; pass move iterators to move
+        // them in. The head index is published once for the whole batch.
+        template <typename ForwardIt>
+        auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+        {
+            auto const n = static_cast<uint64_t>(std::distance(first, last));
+            if (0 == n)
+            {
+                return first;
+            }
+
+            auto const head = m_head.load(std::memory_order_relaxed);
+            if ((m_mask + 1) - (head - m_tail_cache) < n)
+            {
+                m_tail_cache = m_tail.load(std::memory_order_acquire);
+            }
+
+            auto const count = std::min(n, (m_mask + 1) - (head - m_tail_cache));
+            for (auto pos = head; pos != head + count; ++pos, ++first)
+            {
+                ::new (static_cast<void*>(m_slots[pos & m_mask].storage)) T(*first);
+            }
+
+            if (count > 0)
+            {
+                m_head.store(head + count, std::memory_order_release);
+            }
+
+            return first;
+        }
+
+        // try_pop() - attempt to dequeue a value; must only be called by the consumer
+        auto try_pop() -> std::optional<T>
+        {
+            auto const tail = m_tail.load(std::memory_order_relaxed);
+            if (tail == m_head_cache)
+            {
+                m_head_cache = m_head.load(std::memory_order_acquire);
+                if (tail == m_head_cache)
+                {
+                    return std::nullopt;
+                }
+            }
+
+            auto& s = m_slots[tail & m_mask];
+            auto value = std::optional<T>{std::move(*s.value())};
+            s.value()->~T();
+
+            m_tail.store(tail + 1, std::memory_order_release);
+            return value;
+        }
+
+        // empty() - whether try_pop() would fail; must only be called by the consumer
+        auto empty() const noexcept -> bool
+        {
+            return m_tail.load(std::memory_order_relaxed) == m_head.load(std::memory_order_acquire);
+        }
+
+        // try_pop_many() - dequeue up to `max` values; must only be called by the consumer
+        //
+        // Values are written through `out`, which is advanced past them; the
+        // tail index is published once for the whole batch. Should writing a
+        // value throw, the slots released so far are published first and the
+        // value is left in its slot for the next pop.
+        template <typename OutputIt>
+        auto try_pop_many(OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            auto const tail = m_tail.load(std::memory_order_relaxed);
+            if (m_head_cache - tail < max)
+            {
+                m_head_cache = m_head.load(std::memory_order_acquire);
+            }
+
+            auto const count = std::min(static_cast<uint64_t>(max), m_head_cache - tail);
+            for (auto pos = tail; pos != tail + count; ++pos)
+            {
+                auto& s = m_slots[pos & m_mask];
+                try
+                {
+                    *out = std::move(*s.value());
+                    ++out;
+                }
+                catch (...)
+                {
+                    m_tail.store(pos, std::memory_order_release);
+                    throw;
+                }
+                s.value()->~T();
+            }
+
+            if (count > 0)
+            {
+                m_tail.store(tail + count, std::memory_order_release);
+            }
+
+            return static_cast<std::size_t>(count);
+        }
+
+        // size() - approximate number of values currently enqueued
+        auto size() const noexcept -> std::size_t
+        {
+            auto const tail = m_tail.load(std::memory_order_acquire);
+            auto const head = m_head.load(std::memory_order_acquire);
+
+            // read from a third thread, the pair is not a consistent
+            // snapshot; never report more than the ring can hold
+            auto const count = head > tail ? head - tail : 0;
+            return static_cast<std::size_t>(count > m_mask ? m_mask + 1 : count);
+        }
+
+        auto capacity() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(m_mask + 1);
+        }
+    };
+}
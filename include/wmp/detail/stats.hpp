@@ -0,0 +1,201 @@
+// stats.hpp
+//
+// Optional per-channel runtime statistics.
+//
+// When WMP_COLLECT_STATS is defined, every channel counts the messages sent
+// and received through it, its high-water depth, how often senders blocked
+// and the receiver parked, and the total time they spent blocked; the
+// handles of each channel expose a snapshot through stats(). Otherwise the
+// counters are empty and every update compiles away.
+//
+// Counters are sharded: each thread updates the shard selected by a
+// thread-local index, so threads sending on the same channel do not contend
+// on the same cache line. A snapshot sums the shards without synchronizing
+// with concurrent updates, so it is only exact once the channel is quiet.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "cache_line.hpp"
+
+namespace wmp
+{
+    // channel_stats - a snapshot of a channel's counters
+    struct channel_stats
+    {
+        // messages sent into and received from the channel
+        uint64_t sent;
+        uint64_t received;
+
+        // messages held by the channel at the time of the snapshot, and the
+        // most it has held at once
+        uint64_t depth;
+        uint64_t high_water;
+
+        // number of times a sender parked waiting for space, and a receiver
+        // parked waiting for a message
+        uint64_t sender_blocks;
+        uint64_t receiver_parks;
+
+        // total time spent parked, by senders and receivers alike
+        std::chrono::nanoseconds blocked_time;
+    };
+}
+
+namespace wmp::detail
+{
+    // the party that parks in a call to stats_counters::block()
+    enum class blocked_side
+    {
+        sender,
+        receiver
+    };
+
+    // default number of shards for channels with many senders
+    constexpr static std::size_t const STATS_SHARDS = 8;
+
+#if defined(WMP_COLLECT_STATS)
+    constexpr static bool const STATS_ENABLED = true;
+
+    // stats_shard() - the calling thread's shard index (before reduction)
+    inline auto stats_shard() noexcept -> std::size_t
+    {
+        static std::atomic<std::size_t> next{0};
+        thread_local auto const index = next.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    template <std::size_t Shards = STATS_SHARDS>
+    class stats_counters
+    {
+        // a lone shard is not padded, so that channels with a single sender
+        // and receiver (e.g. oneshot) stay compact and pool-allocatable
+        struct alignas(Shards > 1 ? CACHE_LINE_SIZE : alignof(std::atomic<uint64_t>)) shard
+        {
+            std::atomic<uint64_t> sent{0};
+            std::atomic<uint64_t> received{0};
+            std::atomic<uint64_t> high_water{0};
+            std::atomic<uint64_t> sender_blocks{0};
+            std::atomic<uint64_t> receiver_parks{0};
+            std::atomic<uint64_t> blocked_ns{0};
+        };
+
+        std::array<shard, Shards> m_shards;
+
+    public:
+        stats_counters() = default;
+
+        // non-copyable
+        stats_counters(stats_counters const&)            = delete;
+        stats_counters& operator=(stats_counters const&) = delete;
+
+        // non-movable
+        stats_counters(stats_counters&&)            = delete;
+        stats_counters& operator=(stats_counters&&) = delete;
+
+        auto add_sent(uint64_t const count) noexcept -> void
+        {
+            local().sent.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        auto add_received(uint64_t const count) noexcept -> void
+        {
+            local().received.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        // note_depth() - record an observed depth towards the high-water mark
+        auto note_depth(uint64_t const depth) noexcept -> void
+        {
+            auto& high_water = local().high_water;
+            auto current = high_water.load(std::memory_order_relaxed);
+            while (depth > current && !high_water.compare_exchange_weak(
+                current, depth, std::memory_order_relaxed)) {}
+        }
+
+        // block() - invoke `wait`, which parks the calling thread, and account for it
+        template <typename Wait>
+        auto block(blocked_side const side, Wait&& wait) -> decltype(wait())
+        {
+            using namespace std::chrono;
+
+            auto& s = local();
+            (blocked_side::sender == side ? s.sender_blocks : s.receiver_parks)
+                .fetch_add(1, std::memory_order_relaxed);
+
+            auto const start = steady_clock::now();
+            auto const result = wait();
+            s.blocked_ns.fetch_add(
+                static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count()),
+                std::memory_order_relaxed);
+
+            return result;
+        }
+
+        // depth() - messages sent but not yet received, per the counters
+        auto depth() const noexcept -> uint64_t
+        {
+            auto const sent     = sum(&shard::sent);
+            auto const received = sum(&shard::received);
+            return sent > received ? sent - received : 0;
+        }
+
+        // snapshot() - the counters, with the channel's current `depth`
+        auto snapshot(uint64_t const depth) const noexcept -> channel_stats
+        {
+            auto high_water = depth;
+            for (auto const& s : m_shards)
+            {
+                high_water = std::max(high_water, s.high_water.load(std::memory_order_relaxed));
+            }
+
+            return channel_stats{
+                sum(&shard::sent),
+                sum(&shard::received),
+                depth,
+                high_water,
+                sum(&shard::sender_blocks),
+                sum(&shard::receiver_parks),
+                std::chrono::nanoseconds{sum(&shard::blocked_ns)}};
+        }
+
+    private:
+        auto local() noexcept -> shard&
+        {
+            return m_shards[stats_shard() % Shards];
+        }
+
+        auto sum(std::atomic<uint64_t> shard::* counter) const noexcept -> uint64_t
+        {
+            auto total = uint64_t{0};
+            for (auto const& s : m_shards)
+            {
+                total += (s.*counter).load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+    };
+#else
+    constexpr static bool const STATS_ENABLED = false;
+
+    template <std::size_t Shards = STATS_SHARDS>
+    class stats_counters
+    {
+    public:
+        auto add_sent(uint64_t) noexcept -> void {}
+        auto add_received(uint64_t) noexcept -> void {}
+        auto note_depth(uint64_t) noexcept -> void {}
+
+        template <typename Wait>
+        auto block(blocked_side, Wait&& wait) -> decltype(wait())
+        {
+            return wait();
+        }
+    };
+#endif
+}
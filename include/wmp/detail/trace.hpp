@@ -0,0 +1,350 @@
+// trace.hpp
+//
+// Optional low-overhead event tracing.
+//
+// When WMP_TRACE is defined, channels record an event for every send and
+// receive, and the backend records every park (as a block, with its
+// duration) and every wake. Events are written to a ring private to the
+// recording thread, stamped with the CPU's timestamp counter, so recording
+// one costs a thread-local lookup, a counter read and a handful of plain
+// stores; nothing is shared between recording threads. Each ring keeps the
+// most recent WMP_TRACE_CAPACITY events of its thread, and outlives the
+// thread so that its events can still be written out (wmp/trace.hpp). The
+// ring of an exited thread is handed to the next thread to record, so the
+// number of rings is bounded by the number of threads alive at once rather
+// than by the number ever started; such a ring holds the events of each of
+// its threads in turn. Otherwise every recording function compiles away.
+
+#pragma once
+
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#if defined(WMP_TRACE)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+#if !defined(WMP_TRACE_CAPACITY)
+#define WMP_TRACE_CAPACITY 8192
+#endif
+
+namespace wmp::detail
+{
+    enum class trace_kind : uint8_t
+    {
+        send,
+        recv,
+        block,
+        wake
+    };
+
+    // the source of an event; block and wake events come from the backend
+    enum class trace_source : uint8_t
+    {
+        backend,
+        mpsc,
+        oneshot,
+        watch,
+        spsc,
+        mpmc,
+        bus
+    };
+
+    struct trace_record
+    {
+        // timestamp counter at the event (for a block, at its start)
+        uint64_t    tsc;
+        // element count for send / recv, duration in ticks for block
+        uint64_t    arg;
+        // the channel's shared state, or the word a thread parked on / woke
+        void const* object;
+        trace_kind   kind;
+        trace_source source;
+    };
+
+#if defined(WMP_TRACE)
+    constexpr static bool const TRACE_ENABLED = true;
+
+    static_assert((WMP_TRACE_CAPACITY & (WMP_TRACE_CAPACITY - 1)) == 0,
+        "WMP_TRACE_CAPACITY must be a power of two");
+
+    // trace_clock() - the timestamp counter of the calling CPU
+    inline auto trace_clock() noexcept -> uint64_t
+    {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        auto ticks = uint64_t{0};
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // trace_ring - the events recorded by a single thread
+    //
+    // Only the owning thread writes; a reader copies the slots below the
+    // head and then discards any that the writer may have overwritten in
+    // the meantime. Slots are relaxed atomics so that the race is benign.
+    class trace_ring
+    {
+        friend class trace_registry;
+
+        constexpr static std::size_t const MASK = WMP_TRACE_CAPACITY - 1;
+
+        struct slot
+        {
+            std::atomic<uint64_t>    tsc;
+            std::atomic<uint64_t>    arg;
+            std::atomic<void const*> object;
+            std::atomic<uint16_t>    meta;
+        };
+
+        uint32_t const        m_thread;
+        std::atomic<uint64_t> m_head;
+        slot                  m_slots[WMP_TRACE_CAPACITY];
+
+        // links maintained by the registry, under its lock
+        trace_ring* m_next;       // every ring, in order of creation
+        trace_ring* m_next_free;  // rings of exited threads
+
+    public:
+        explicit trace_ring(uint32_t const thread) noexcept
+            : m_thread{thread}
+            , m_head{0}
+            , m_next{nullptr}
+            , m_next_free{nullptr} {}
+
+        auto thread() const noexcept -> uint32_t
+        {
+            return m_thread;
+        }
+
+        auto record(trace_record const& r) noexcept -> void
+        {
+            auto const head = m_head.load(std::memory_order_relaxed);
+            auto& s = m_slots[head & MASK];
+            s.tsc.store(r.tsc, std::memory_order_relaxed);
+            s.arg.store(r.arg, std::memory_order_relaxed);
+            s.object.store(r.object, std::memory_order_relaxed);
+            s.meta.store(static_cast<uint16_t>(
+                (static_cast<uint16_t>(r.source) << 8) | static_cast<uint16_t>(r.kind)),
+                std::memory_order_relaxed);
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        // snapshot() - append the events currently held, oldest first
+        //
+        // Once the ring has wrapped, the oldest slot is withheld, since the
+        // writer may be in the middle of reusing it.
+        auto snapshot(std::vector<trace_record>& out) const -> void
+        {
+            auto const head  = m_head.load(std::memory_order_acquire);
+            auto const first = head > WMP_TRACE_CAPACITY ? head - WMP_TRACE_CAPACITY : 0;
+
+            auto const base = out.size();
+            for (auto i = first; i < head; ++i)
+            {
+                auto const& s    = m_slots[i & MASK];
+                auto const  meta = s.meta.load(std::memory_order_relaxed);
+                out.push_back(trace_record{
+                    s.tsc.load(std::memory_order_relaxed),
+                    s.arg.load(std::memory_order_relaxed),
+                    s.object.load(std::memory_order_relaxed),
+                    static_cast<trace_kind>(meta & 0xFF),
+                    static_cast<trace_source>(meta >> 8)});
+            }
+
+            // the oldest slots may have been reused (or be in the middle of
+            // being reused, at index `now`) while they were copied
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto const now  = m_head.load(std::memory_order_relaxed) + 1;
+            auto const torn = now > WMP_TRACE_CAPACITY + first ? now - WMP_TRACE_CAPACITY - first : 0;
+            auto const drop = static_cast<std::size_t>(std::min<uint64_t>(torn, head - first));
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(base),
+                      out.begin() + static_cast<std::ptrdiff_t>(base + drop));
+        }
+    };
+
+    // trace_registry - every thread's ring, and the clock reference for them all
+    //
+    // Rings are only freed with the registry itself, so a ring returned by
+    // rings() remains valid even if its thread exits meanwhile.
+    class trace_registry
+    {
+        std::mutex  m_lock;
+        trace_ring* m_first;
+        trace_ring* m_last;
+        trace_ring* m_free;
+        uint32_t    m_count;
+
+        // a simultaneous reading of both clocks, to convert ticks to time
+        uint64_t const                              m_epoch_tsc;
+        std::chrono::steady_clock::time_point const m_epoch;
+
+    public:
+        trace_registry()
+            : m_first{nullptr}
+            , m_last{nullptr}
+            , m_free{nullptr}
+            , m_count{0}
+            , m_epoch_tsc{trace_clock()}
+            , m_epoch{std::chrono::steady_clock::now()} {}
+
+        ~trace_registry()
+        {
+            while (m_first)
+            {
+                delete std::exchange(m_first, m_first->m_next);
+            }
+        }
+
+        // non-copyable
+        trace_registry(trace_registry const&)            = delete;
+        trace_registry& operator=(trace_registry const&) = delete;
+
+        // non-movable
+        trace_registry(trace_registry&&)            = delete;
+        trace_registry& operator=(trace_registry&&) = delete;
+
+        // attach() - a ring for the calling thread; nullptr if none can be allocated
+        auto attach() noexcept -> trace_ring*
+        {
+            auto guard = std::lock_guard{m_lock};
+            if (m_free)
+            {
+                return std::exchange(m_free, m_free->m_next_free);
+            }
+
+            auto* const ring = new (std::nothrow) trace_ring{m_count + 1};
+            if (ring)
+            {
+                ++m_count;
+                (m_last ? m_last->m_next : m_first) = ring;
+                m_last = ring;
+            }
+            return ring;
+        }
+
+        // detach() - return the ring of an exiting thread for reuse
+        auto detach(trace_ring* const ring) noexcept -> void
+        {
+            auto guard = std::lock_guard{m_lock};
+            ring->m_next_free = std::exchange(m_free, ring);
+        }
+
+        auto rings() -> std::vector<trace_ring const*>
+        {
+            auto out = std::vector<trace_ring const*>{};
+
+            auto guard = std::lock_guard{m_lock};
+            out.reserve(m_count);
+            for (auto const* ring = m_first; ring; ring = ring->m_next)
+            {
+                out.push_back(ring);
+            }
+            return out;
+        }
+
+        auto epoch_tsc() const noexcept -> uint64_t
+        {
+            return m_epoch_tsc;
+        }
+
+        auto epoch() const noexcept -> std::chrono::steady_clock::time_point
+        {
+            return m_epoch;
+        }
+    };
+
+    inline auto trace_registry_instance() -> trace_registry&
+    {
+        static auto registry = trace_registry{};
+        return registry;
+    }
+
+    // trace_owner - holds the calling thread's ring, returning it to the registry on exit
+    class trace_owner
+    {
+        trace_ring* const m_ring;
+
+    public:
+        trace_owner() noexcept
+            : m_ring{trace_registry_instance().attach()} {}
+
+        ~trace_owner()
+        {
+            if (m_ring)
+            {
+                trace_registry_instance().detach(m_ring);
+            }
+        }
+
+        // non-copyable
+        trace_owner(trace_owner const&)            = delete;
+        trace_owner& operator=(trace_owner const&) = delete;
+
+        auto ring() const noexcept -> trace_ring*
+        {
+            return m_ring;
+        }
+    };
+
+    // trace_local() - the calling thread's ring; nullptr if none could be allocated
+    inline auto trace_local() noexcept -> trace_ring*
+    {
+        thread_local trace_owner const owner{};
+        return owner.ring();
+    }
+
+    // trace_event() - record an event on the calling thread
+    inline auto trace_event(
+        trace_kind const   kind,
+        trace_source const source,
+        void const* const  object,
+        uint64_t const     arg = 1) noexcept -> void
+    {
+        if (auto* const ring = trace_local())
+        {
+            ring->record(trace_record{trace_clock(), arg, object, kind, source});
+        }
+    }
+
+    // trace_block() - invoke `wait`, which parks the calling thread, and record it
+    template <typename Wait>
+    auto trace_block(void const* const object, Wait&& wait) noexcept -> decltype(wait())
+    {
+        auto const start  = trace_clock();
+        auto const result = wait();
+        if (auto* const ring = trace_local())
+        {
+            ring->record(trace_record{
+                start, trace_clock() - start, object, trace_kind::block, trace_source::backend});
+        }
+        return result;
+    }
+#else
+    constexpr static bool const TRACE_ENABLED = false;
+
+    inline auto trace_event(trace_kind, trace_source, void const*, uint64_t = 1) noexcept -> void {}
+
+    template <typename Wait>
+    auto trace_block(void const*, Wait&& wait) noexcept -> decltype(wait())
+    {
+        return wait();
+    }
+#endif
+}
@@ -0,0 +1,275 @@
+// unbounded_queue.hpp
+//
+// An unbounded, intrusive-node, multiple-producer single-consumer queue.
+//
+// This is Dmitry Vyukov's non-intrusive MPSC node queue: a push is a single
+// atomic exchange on the head pointer followed by a release store that links
+// the previous node, so producers are wait-free and never fail. The consumer
+// follows `next` pointers from a stub node and never executes an atomic
+// read-modify-write.
+//
+// Nodes released by the consumer are recycled through a bounded, lock-free
+// freelist shared with the producers so that steady-state traffic does not
+// touch the allocator; when the freelist is empty producers allocate, and
+// when it is full the consumer frees.
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <iterator>
+#include <cstddef>
+#include <utility>
+#include <optional>
+#include <type_traits>
+
+#include "cache_line.hpp"
+#include "bounded_ring.hpp"
+
+namespace wmp::detail
+{
+    // default number of nodes retained by a queue's freelist
+    constexpr static std::size_t const FREELIST_CAPACITY = 1024;
+
+    template <typename T>
+    class unbounded_queue
+    {
+        struct node
+        {
+            std::atomic<node*> next;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            node() noexcept
+                : next{nullptr} {}
+
+            auto value() noexcept -> T*
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        // most recently pushed node; exchanged by producers
+        alignas(CACHE_LINE_SIZE) std::atomic<node*> m_head;
+        // stub node whose successor (if any) holds the oldest value; consumer only
+        alignas(CACHE_LINE_SIZE) node* m_tail;
+
+        // recycled nodes, pushed by the consumer and popped by producers
+        bounded_ring<node*> m_freelist;
+
+    public:
+        constexpr static bool const is_bounded = false;
+
+        explicit unbounded_queue(std::size_t const freelist_capacity = FREELIST_CAPACITY)
+            : m_head{nullptr}
+            , m_tail{nullptr}
+            , m_freelist{freelist_capacity}
+        {
+            auto* stub = new node{};
+            m_head.store(stub, std::memory_order_relaxed);
+            m_tail = stub;
+        }
+
+        ~unbounded_queue()
+        {
+            while (try_pop().has_value()) {}
+            delete m_tail;
+
+            while (auto n = m_freelist.try_pop_shared())
+            {
+                delete n.value();
+            }
+        }
+
+        // non-copyable
+        unbounded_queue(unbounded_queue const&)            = delete;
+        unbounded_queue& operator=(unbounded_queue const&) = delete;
+
+        // non-movable
+        unbounded_queue(unbounded_queue&&)            = delete;
+        unbounded_queue& operator=(unbounded_queue&&) = delete;
+
+        // try_push() - enqueue a value, safe for concurrent producers
+        //
+        // Never fails (short of allocation failure); the return value exists
+        // only for interface parity with bounded_ring.
+        template <typename U>
+        auto try_push(U&& value) -> bool
+        {
+            return try_emplace(std::forward<U>(value));
+        }
+
+        // try_emplace() - construct a value in place, safe for concurrent producers
+        template <typename... Args>
+        auto try_emplace(Args&&... args) -> bool
+        {
+            auto* n = make_node(std::forward<Args>(args)...);
+
+            auto* prev = m_head.exchange(n, std::memory_order_acq_rel);
+            prev->next.store(n, std::memory_order_release);
+            return true;
+        }
+
+        // try_push_many() - enqueue all of [first, last) with a single exchange
+        //
+        // The values are linked into a private chain first, which is then
+        // spliced onto the queue exactly as a single node would be. Values
+        // are constructed from `*first`; pass move iterators to move them in.
+        // Should a constructor throw, the chain built so far is discarded
+        // and nothing is enqueued.
+        template <typename ForwardIt>
+        auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+        {
+            if (first == last)
+            {
+                return first;
+            }
+
+            auto* chain_first = make_node(*first);
+            auto* chain_last  = chain_first;
+
+            if constexpr (std::is_nothrow_constructible_v<T, decltype(*first)>)
+            {
+                for (++first; first != last; ++first)
+                {
+                    auto* n = make_node(*first);
+                    chain_last->next.store(n, std::memory_order_relaxed);
+                    chain_last = n;
+                }
+            }
+            else
+            {
+                try
+                {
+                    for (++first; first != last; ++first)
+                    {
+                        auto* n = make_node(*first);
+                        chain_last->next.store(n, std::memory_order_relaxed);
+                        chain_last = n;
+                    }
+                }
+                catch (...)
+                {
+                    discard_chain(chain_first);
+                    throw;
+                }
+            }
+
+            auto* prev = m_head.exchange(chain_last, std::memory_order_acq_rel);
+            prev->next.store(chain_first, std::memory_order_release);
+            return first;
+        }
+
+        // try_pop() - attempt to dequeue a value; must only be called by the consumer
+        //
+        // May transiently report an empty queue while a producer is between
+        // its exchange and its link; that producer notifies after linking.
+        auto try_pop() -> std::optional<T>
+        {
+            auto* tail = m_tail;
+            auto* next = tail->next.load(std::memory_order_acquire);
+            if (nullptr == next)
+            {
+                return std::nullopt;
+            }
+
+            // `next` becomes the new stub once its value is moved out
+            auto value = std::optional<T>{std::move(*next->value())};
+            next->value()->~T();
+            m_tail = next;
+
+            release_node(tail);
+            return value;
+        }
+
+        // empty() - whether try_pop() would fail; must only be called by the consumer
+        auto empty() const noexcept -> bool
+        {
+            return nullptr == m_tail->next.load(std::memory_order_acquire);
+        }
+
+        // try_pop_many() - dequeue up to `max` values; must only be called by the consumer
+        template <typename OutputIt>
+        auto try_pop_many(OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            auto count = std::size_t{0};
+            while (count < max)
+            {
+                auto* tail = m_tail;
+                auto* next = tail->next.load(std::memory_order_acquire);
+                if (nullptr == next)
+                {
+                    break;
+                }
+
+                *out = std::move(*next->value());
+                ++out;
+                next->value()->~T();
+                m_tail = next;
+
+                release_node(tail);
+                ++count;
+            }
+
+            return count;
+        }
+
+    private:
+        // make_node() - acquire an unlinked node and construct its value
+        //
+        // Should the constructor throw, the node is released before the
+        // exception propagates.
+        template <typename... Args>
+        auto make_node(Args&&... args) -> node*
+        {
+            auto* n = acquire_node();
+            if constexpr (std::is_nothrow_constructible_v<T, Args&&...>)
+            {
+                ::new (static_cast<void*>(n->storage)) T(std::forward<Args>(args)...);
+            }
+            else
+            {
+                try
+                {
+                    ::new (static_cast<void*>(n->storage)) T(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    release_node(n);
+                    throw;
+                }
+            }
+
+            n->next.store(nullptr, std::memory_order_relaxed);
+            return n;
+        }
+
+        // discard_chain() - destroy the values of a private chain and release its nodes
+        auto discard_chain(node* n) noexcept -> void
+        {
+            while (nullptr != n)
+            {
+                auto* next = n->next.load(std::memory_order_relaxed);
+                n->value()->~T();
+                release_node(n);
+                n = next;
+            }
+        }
+
+        auto acquire_node() -> node*
+        {
+            if (auto recycled = m_freelist.try_pop_shared())
+            {
+                return recycled.value();
+            }
+            return new node{};
+        }
+
+        auto release_node(node* n) noexcept -> void
+        {
+            if (!m_freelist.try_push(n))
+            {
+                delete n;
+            }
+        }
+    };
+}
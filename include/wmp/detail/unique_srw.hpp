@@ -2,8 +2,7 @@
 
 #pragma once
 
-#include <windows.h>
-
+#include "backend.hpp"
 #include "srw_acquire.hpp"
 
 namespace wmp::detail
@@ -18,12 +17,12 @@ namespace wmp::detail
             unlocked
         };
 
-        PSRWLOCK    m_lock;
+        srw_lock*   m_lock;
         state       m_state;
         srw_acquire m_ownership;
 
     public:
-        unique_srw(PSRWLOCK lock, srw_acquire ownership)
+        unique_srw(srw_lock* lock, srw_acquire ownership)
             : m_lock{lock}
             , m_state{state::unlocked}
             , m_ownership{ownership}
@@ -49,7 +48,10 @@ namespace wmp::detail
             : m_lock{other.m_lock}
             , m_state{other.m_state}
             , m_ownership{other.m_ownership}
-        {}
+        {
+            other.m_lock  = nullptr;
+            other.m_state = state::unlocked;
+        }
 
         // move-assignable
         // QUESTION: can this be defaulted?
@@ -103,11 +105,11 @@ namespace wmp::detail
         {
             if (srw_acquire::exclusive == m_ownership)
             {
-                ::AcquireSRWLockExclusive(m_lock);
+                m_lock->acquire_exclusive();
             }
             else
             {
-                ::AcquireSRWLockShared(m_lock);
+                m_lock->acquire_shared();
             }
 
             m_state = state::locked;
@@ -117,11 +119,11 @@ namespace wmp::detail
         {
             if (srw_acquire::exclusive == m_ownership)
             {
-                ::ReleaseSRWLockExclusive(m_lock);
+                m_lock->release_exclusive();
             }
             else
             {
-                ::ReleaseSRWLockShared(m_lock);
+                m_lock->release_shared();
             }
 
             m_state = state::unlocked;
@@ -0,0 +1,168 @@
+// waiter.hpp
+//
+// Readiness notification for wmp::select() and coroutine awaitables.
+//
+// A thread blocked in select() owns a single waiter, registers it with the
+// waiter_list of every channel it selects over, and parks on it; a channel
+// signals every registered waiter whenever it becomes ready. A suspended
+// coroutine registers a waiter in the same way, whose signal schedules the
+// coroutine's resumption instead (see coro.hpp).
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "backend.hpp"
+#include "scoped_srw.hpp"
+
+namespace wmp::detail
+{
+    // ------------------------------------------------------------------------
+    // waiter
+
+    // waiter - a registration target that a channel signals when it becomes ready
+    //
+    // The signal is dispatched through a function pointer rather than a
+    // virtual call, so that a waiter remains a plain (non-polymorphic) type.
+    class waiter
+    {
+        using signal_fn = void (*)(waiter&) noexcept;
+
+        signal_fn m_signal;
+
+    protected:
+        explicit waiter(signal_fn signal) noexcept
+            : m_signal{signal} {}
+
+        ~waiter() = default;
+
+    public:
+        // non-copyable
+        waiter(waiter const&)            = delete;
+        waiter& operator=(waiter const&) = delete;
+
+        // non-movable
+        waiter(waiter&&)            = delete;
+        waiter& operator=(waiter&&) = delete;
+
+        // notify() - signal the waiter; invoked with its waiter_list's lock held
+        auto notify() noexcept -> void
+        {
+            m_signal(*this);
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // thread_waiter
+
+    // thread_waiter - a waiter on which a thread parks
+    class thread_waiter : public waiter
+    {
+        std::atomic<uint32_t> m_signaled;
+
+    public:
+        thread_waiter() noexcept
+            : waiter{&signal}
+            , m_signaled{0} {}
+
+        // reset() - clear the signal; the owner re-checks its condition afterward
+        auto reset() noexcept -> void
+        {
+            m_signaled.store(0, std::memory_order_relaxed);
+        }
+
+        // wait() - park until signaled; returns `false` if the deadline passed first
+        auto wait(deadline const until) noexcept -> bool
+        {
+            while (0 == m_signaled.load(std::memory_order_acquire))
+            {
+                if (!wait_on_address(m_signaled, 0, until))
+                {
+                    return 0 != m_signaled.load(std::memory_order_acquire);
+                }
+            }
+            return true;
+        }
+
+    private:
+        // signal() - wake the parked thread, if this is the first signal since reset()
+        static auto signal(waiter& w) noexcept -> void
+        {
+            auto& self = static_cast<thread_waiter&>(w);
+            if (0 == self.m_signaled.exchange(1, std::memory_order_release))
+            {
+                wake_address_one(self.m_signaled);
+            }
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // waiter_list
+
+    class waiter_list
+    {
+        srw_lock              m_lock;
+        std::vector<waiter*>  m_waiters;
+
+        // mirrors m_waiters.size(), so that notify() is a single load
+        // whenever no thread is selecting on the channel
+        std::atomic<uint32_t> m_count;
+
+    public:
+        waiter_list()
+            : m_waiters{}
+            , m_count{0} {}
+
+        // non-copyable
+        waiter_list(waiter_list const&)            = delete;
+        waiter_list& operator=(waiter_list const&) = delete;
+
+        // non-movable
+        waiter_list(waiter_list&&)            = delete;
+        waiter_list& operator=(waiter_list&&) = delete;
+
+        // add() - register a waiter
+        //
+        // The caller must issue a sequentially consistent fence after add()
+        // and before it re-checks the channel's readiness.
+        auto add(waiter* w) -> void
+        {
+            auto guard = scoped_srw{&m_lock, srw_acquire::exclusive};
+            m_waiters.push_back(w);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // remove() - withdraw a registered waiter; it is never signaled afterward
+        auto remove(waiter* w) -> void
+        {
+            auto guard = scoped_srw{&m_lock, srw_acquire::exclusive};
+            m_waiters.erase(std::find(m_waiters.begin(), m_waiters.end(), w));
+            m_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // notify() - signal every registered waiter
+        //
+        // The caller must issue a sequentially consistent fence between
+        // making the channel ready and calling notify(); that fence pairs
+        // with the one following add().
+        auto notify() -> void
+        {
+            if (0 == m_count.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            auto guard = scoped_srw{&m_lock, srw_acquire::shared};
+            for (auto* w : m_waiters)
+            {
+                w->notify();
+            }
+        }
+    };
+
+    // grants wmp::select() access to the waiter_list of a receiver's channel
+    struct select_access;
+}
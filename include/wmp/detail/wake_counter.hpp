@@ -0,0 +1,32 @@
+// wake_counter.hpp
+//
+// Optional accounting of wake operations issued by the backend.
+//
+// When WMP_COUNT_WAKES is defined, every call that wakes a parked thread
+// (cond_var::wake_one() / wake_all(), wake_address_one() / wake_address_all())
+// increments a process-wide counter; otherwise count_wake() compiles away.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace wmp::detail
+{
+#if defined(WMP_COUNT_WAKES)
+    inline std::atomic<uint64_t> wake_count{0};
+
+    inline auto count_wake() noexcept -> void
+    {
+        wake_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // wakes() - the number of wake operations issued so far
+    inline auto wakes() noexcept -> uint64_t
+    {
+        return wake_count.load(std::memory_order_relaxed);
+    }
+#else
+    inline auto count_wake() noexcept -> void {}
+#endif
+}
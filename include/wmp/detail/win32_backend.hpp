@@ -0,0 +1,227 @@
+// win32_backend.hpp
+//
+// Synchronization backend built on SRWLOCK and CONDITION_VARIABLE.
+
+#pragma once
+
+#include <windows.h>
+
+#include <atomic>
+#include <cstdint>
+#include <system_error>
+
+#include "deadline.hpp"
+#include "srw_acquire.hpp"
+#include "trace.hpp"
+#include "wake_counter.hpp"
+
+namespace wmp::detail
+{
+    // to_wait_ms() - the time remaining until `until`, rounded up to whole milliseconds
+    //
+    // The Win32 waits accept millisecond timeouts only; rounding up means
+    // that a wait never ends before its deadline.
+    inline auto to_wait_ms(deadline const until) noexcept -> DWORD
+    {
+        if (until.is_never())
+        {
+            return INFINITE;
+        }
+
+        auto const ms = std::chrono::ceil<std::chrono::milliseconds>(until.remaining()).count();
+        return ms < static_cast<long long>(INFINITE)
+            ? static_cast<DWORD>(ms)
+            : INFINITE - 1;
+    }
+
+    // ------------------------------------------------------------------------
+    // address waiting
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+    // wait_on_address() - sleep while `word` holds `expected`
+    //
+    // Returns `false` if the deadline passed; spurious returns are possible
+    // and callers are expected to re-check the word.
+    inline auto wait_on_address(
+        std::atomic<uint32_t>& word,
+        uint32_t               expected,
+        deadline const         until = deadline::never()) noexcept -> bool
+    {
+        return trace_block(&word, [&]() {
+            if (::WaitOnAddress(&word, &expected, sizeof(expected), to_wait_ms(until)))
+            {
+                return true;
+            }
+            return ::GetLastError() != ERROR_TIMEOUT;
+        });
+    }
+
+    inline auto wake_address_one(std::atomic<uint32_t>& word) noexcept -> void
+    {
+        count_wake();
+        trace_event(trace_kind::wake, trace_source::backend, &word);
+        ::WakeByAddressSingle(&word);
+    }
+
+    inline auto wake_address_all(std::atomic<uint32_t>& word) noexcept -> void
+    {
+        count_wake();
+        trace_event(trace_kind::wake, trace_source::backend, &word);
+        ::WakeByAddressAll(&word);
+    }
+
+    // ------------------------------------------------------------------------
+    // native_event
+
+    // native_event - a manual-reset event object
+    //
+    // The handle is signaled while the event is set, so it can be passed to
+    // WaitForMultipleObjects() alongside other handles.
+    class native_event
+    {
+        HANDLE m_event;
+
+    public:
+        using native_handle_type = HANDLE;
+
+        native_event()
+            : m_event{::CreateEventW(nullptr, TRUE, FALSE, nullptr)}
+        {
+            if (nullptr == m_event)
+            {
+                throw std::system_error{
+                    static_cast<int>(::GetLastError()), std::system_category(), "CreateEventW"};
+            }
+        }
+
+        ~native_event()
+        {
+            ::CloseHandle(m_event);
+        }
+
+        // non-copyable
+        native_event(native_event const&)            = delete;
+        native_event& operator=(native_event const&) = delete;
+
+        // non-movable
+        native_event(native_event&&)            = delete;
+        native_event& operator=(native_event&&) = delete;
+
+        auto set() noexcept -> void
+        {
+            ::SetEvent(m_event);
+        }
+
+        auto reset() noexcept -> void
+        {
+            ::ResetEvent(m_event);
+        }
+
+        auto native_handle() const noexcept -> native_handle_type
+        {
+            return m_event;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // srw_lock
+
+    class srw_lock
+    {
+        SRWLOCK m_lock;
+
+    public:
+        srw_lock() noexcept
+            : m_lock{SRWLOCK_INIT} {}
+
+        ~srw_lock() = default;
+
+        // non-copyable
+        srw_lock(srw_lock const&)            = delete;
+        srw_lock& operator=(srw_lock const&) = delete;
+
+        // non-movable
+        srw_lock(srw_lock&&)            = delete;
+        srw_lock& operator=(srw_lock&&) = delete;
+
+        auto acquire_exclusive() noexcept -> void
+        {
+            ::AcquireSRWLockExclusive(&m_lock);
+        }
+
+        auto acquire_shared() noexcept -> void
+        {
+            ::AcquireSRWLockShared(&m_lock);
+        }
+
+        auto release_exclusive() noexcept -> void
+        {
+            ::ReleaseSRWLockExclusive(&m_lock);
+        }
+
+        auto release_shared() noexcept -> void
+        {
+            ::ReleaseSRWLockShared(&m_lock);
+        }
+
+        auto native() noexcept -> PSRWLOCK
+        {
+            return &m_lock;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // cond_var
+
+    class cond_var
+    {
+        CONDITION_VARIABLE m_cv;
+
+    public:
+        cond_var() noexcept
+            : m_cv{CONDITION_VARIABLE_INIT} {}
+
+        ~cond_var() = default;
+
+        // non-copyable
+        cond_var(cond_var const&)            = delete;
+        cond_var& operator=(cond_var const&) = delete;
+
+        // non-movable
+        cond_var(cond_var&&)            = delete;
+        cond_var& operator=(cond_var&&) = delete;
+
+        // sleep() - atomically release `lock` and wait for a wake
+        //
+        // The lock must be held with the specified ownership on entry and
+        // is held with the same ownership on exit. Returns `false` if the
+        // deadline passed before the thread was woken.
+        auto sleep(
+            srw_lock&           lock,
+            srw_acquire const   ownership,
+            deadline const      until = deadline::never()) noexcept -> bool
+        {
+            auto const flags = srw_acquire::shared == ownership
+                ? CONDITION_VARIABLE_LOCKMODE_SHARED
+                : 0ul;
+            return trace_block(&m_cv, [&]() {
+                return ::SleepConditionVariableSRW(&m_cv, lock.native(), to_wait_ms(until), flags) != FALSE;
+            });
+        }
+
+        auto wake_one() noexcept -> void
+        {
+            count_wake();
+            trace_event(trace_kind::wake, trace_source::backend, &m_cv);
+            ::WakeConditionVariable(&m_cv);
+        }
+
+        auto wake_all() noexcept -> void
+        {
+            count_wake();
+            trace_event(trace_kind::wake, trace_source::backend, &m_cv);
+            ::WakeAllConditionVariable(&m_cv);
+        }
+    };
+}
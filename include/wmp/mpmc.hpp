@@ -0,0 +1,318 @@
+// mpmc.hpp
+//
+// A bounded, multiple-producer, multiple-consumer work-distribution channel.
+//
+// Both senders and receivers may be cloned; every message is delivered to
+// exactly one receiver. Receivers claim messages with a CAS on the ring's
+// tail, so an idle receiver takes the next message regardless of how long
+// its peers spend on theirs.
+
+#pragma once
+
+#include <tuple>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+
+#include "detail/event.hpp"
+#include "detail/trace.hpp"
+#include "detail/backend.hpp"
+#include "detail/cache_line.hpp"
+#include "detail/bounded_ring.hpp"
+
+namespace wmp::mpmc
+{
+    // ------------------------------------------------------------------------
+    // detail::inner
+
+    namespace detail
+    {
+        template <typename T>
+        struct inner
+        {
+            wmp::detail::bounded_ring<T> buffer;
+
+            // receivers park on nonempty, senders on nonfull
+            alignas(wmp::detail::CACHE_LINE_SIZE) wmp::detail::event nonempty;
+            alignas(wmp::detail::CACHE_LINE_SIZE) wmp::detail::event nonfull;
+
+            // live handle counts; the channel is disconnected once either reaches zero
+            std::atomic<uint32_t> senders;
+            std::atomic<uint32_t> receivers;
+
+            explicit inner(std::size_t const capacity)
+                : buffer{capacity}
+                , nonempty{}
+                , nonfull{}
+                , senders{0}
+                , receivers{0} {}
+        };
+
+        // trace_event() - record a send or receive of a single value
+        template <typename T>
+        auto trace_event(inner<T> const& shared, wmp::detail::trace_kind const kind) -> void
+        {
+            wmp::detail::trace_event(kind, wmp::detail::trace_source::mpmc, &shared);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // sender
+
+    enum class send_result
+    {
+        success,
+        failure,
+        timeout
+    };
+
+    template <typename T>
+    class sender
+    {
+        std::shared_ptr<detail::inner<T>> m_inner;
+
+    public:
+        sender(std::shared_ptr<detail::inner<T>> inner)
+            : m_inner{inner}
+        {
+            m_inner->senders.fetch_add(1);
+        }
+
+        ~sender()
+        {
+            release();
+        }
+
+        // non-copyable, outside explicit clone()
+        sender(sender const&)            = delete;
+        sender& operator=(sender const&) = delete;
+
+        sender(sender&&) = default;
+
+        // releases the channel previously held, as the destructor does
+        sender& operator=(sender&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_inner = std::move(other.m_inner);
+            }
+            return *this;
+        }
+
+        auto clone() -> sender<T>
+        {
+            return sender{m_inner};
+        }
+
+        // send() - blocking send operation (indefinite timeout)
+        //
+        // Fails only if every receiver has been dropped.
+        auto send(T value) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::never());
+        }
+
+        // send_timeout() - blocking send operation with timeout
+        template <typename Duration>
+        auto send_timeout(T value, Duration timeout) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::after(timeout));
+        }
+
+        // send_until() - blocking send operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto send_until(T value, std::chrono::time_point<Clock, Duration> const& deadline) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::at(deadline));
+        }
+
+        // try_send() - non-blocking send operation
+        auto try_send(T value) -> send_result
+        {
+            if (0 == m_inner->receivers.load() || !m_inner->buffer.try_push(std::move(value)))
+            {
+                return send_result::failure;
+            }
+
+            detail::trace_event(*m_inner, wmp::detail::trace_kind::send);
+            m_inner->nonempty.notify_one();
+            return send_result::success;
+        }
+
+    private:
+        auto release() noexcept -> void
+        {
+            // don't attempt to disconnect when in moved-from state
+            if (m_inner && 1 == m_inner->senders.fetch_sub(1))
+            {
+                // the final sender; parked receivers drain and then observe it
+                m_inner->nonempty.notify_all();
+            }
+        }
+
+        auto send_by(T&& value, wmp::detail::deadline const until) -> send_result
+        {
+            auto disconnected = false;
+
+            auto const done = m_inner->nonfull.await(
+                [&]() {
+                    disconnected = 0 == m_inner->receivers.load();
+                    return disconnected || m_inner->buffer.try_push(std::move(value));
+                },
+                until);
+
+            if (!done)
+            {
+                return send_result::timeout;
+            }
+            else if (disconnected)
+            {
+                return send_result::failure;
+            }
+
+            detail::trace_event(*m_inner, wmp::detail::trace_kind::send);
+            m_inner->nonempty.notify_one();
+            return send_result::success;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // receiver
+
+    template <typename T>
+    class receiver
+    {
+        std::shared_ptr<detail::inner<T>> m_inner;
+
+    public:
+        receiver(std::shared_ptr<detail::inner<T>> inner)
+            : m_inner{inner}
+        {
+            m_inner->receivers.fetch_add(1);
+        }
+
+        ~receiver()
+        {
+            release();
+        }
+
+        // non-copyable, outside explicit clone()
+        receiver(receiver const&)            = delete;
+        receiver& operator=(receiver const&) = delete;
+
+        receiver(receiver&&) = default;
+
+        // releases the channel previously held, as the destructor does
+        receiver& operator=(receiver&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_inner = std::move(other.m_inner);
+            }
+            return *this;
+        }
+
+        auto clone() -> receiver<T>
+        {
+            return receiver{m_inner};
+        }
+
+        // recv() - blocking receive operation (indefinite timeout)
+        //
+        // Returns an empty std::optional once every sender has been dropped
+        // and the channel has been drained.
+        auto recv() -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::never());
+        }
+
+        // recv_timeout() - blocking receive operation with timeout
+        template <typename Duration>
+        auto recv_timeout(Duration timeout) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::after(timeout));
+        }
+
+        // recv_until() - blocking receive operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto recv_until(std::chrono::time_point<Clock, Duration> const& deadline) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::at(deadline));
+        }
+
+        // try_recv() - non-blocking receive operation
+        auto try_recv() -> std::optional<T>
+        {
+            auto value = m_inner->buffer.try_pop_shared();
+            if (value.has_value())
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::recv);
+                m_inner->nonfull.notify_all();
+            }
+
+            return value;
+        }
+
+    private:
+        auto release() noexcept -> void
+        {
+            // don't attempt to disconnect when in moved-from state
+            if (m_inner && 1 == m_inner->receivers.fetch_sub(1))
+            {
+                // the final receiver; parked senders observe it and fail
+                m_inner->nonfull.notify_all();
+            }
+        }
+
+        auto recv_by(wmp::detail::deadline const until) -> std::optional<T>
+        {
+            auto value = std::optional<T>{};  // std::nullopt
+
+            m_inner->nonempty.await(
+                [&]() {
+                    if ((value = m_inner->buffer.try_pop_shared()).has_value())
+                    {
+                        return true;
+                    }
+                    else if (0 != m_inner->senders.load())
+                    {
+                        return false;
+                    }
+
+                    // every value sent before the final sender dropped is
+                    // visible once the drop is, so one last attempt is conclusive
+                    value = m_inner->buffer.try_pop_shared();
+                    return true;
+                },
+                until);
+
+            if (value.has_value())
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::recv);
+                m_inner->nonfull.notify_all();
+            }
+
+            return value;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // create()
+
+    // create() - construct a new bounded mpmc channel
+    //
+    // The channel is backed by a lock-free ring; the requested capacity
+    // is rounded up to the next power of two.
+    template <typename T>
+    auto create(std::size_t const capacity) -> std::pair<sender<T>, receiver<T>>
+    {
+        auto shared_inner = std::make_shared<detail::inner<T>>(capacity);
+        return std::pair{ sender<T>{shared_inner}, receiver<T>{shared_inner} };
+    }
+}
@@ -1,41 +1,461 @@
 // mpsc.hpp
 
-#include <windows.h>
+#pragma once
 
 #include <tuple>
-#include <queue>
+#include <atomic>
 #include <memory>
 #include <chrono>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
 #include <optional>
+#include <type_traits>
 
+#include "detail/spin.hpp"
+#include "detail/coro.hpp"
+#include "detail/stats.hpp"
+#include "detail/trace.hpp"
+#include "detail/backend.hpp"
+#include "detail/waiter.hpp"
+#include "detail/pollable.hpp"
 #include "detail/scoped_srw.hpp"
 #include "detail/unique_srw.hpp"
+#include "detail/inline_any.hpp"
+#include "detail/bounded_ring.hpp"
+#include "detail/priority_ring.hpp"
+#include "detail/sharded_ring.hpp"
+#include "detail/unbounded_queue.hpp"
+#include "detail/segmented_queue.hpp"
 
 namespace wmp::mpsc
 {
+    // overflow - what a send does when a bounded channel is full
+    enum class overflow
+    {
+        // wait for the receiver to make room (try_send() fails instead)
+        block,
+        // discard the value being sent
+        drop_newest,
+        // discard the oldest value in the channel to make room
+        drop_oldest,
+        overwrite = drop_oldest
+    };
+
     // ------------------------------------------------------------------------
     // detail::inner
 
     namespace detail
     {
-        template <typename T>
+        // fields of inner::senders_waiting; a notification clears the count
+        // and starts a new epoch, so that a parked sender can tell whether
+        // its registration has been consumed
+        constexpr static uint32_t const SENDERS_PARKED = 0x0000ffff;
+        constexpr static uint32_t const SENDERS_EPOCH  = 0x00010000;
+
+        // the storage engine behind a channel; Buffer is one of
+        //  - wmp::detail::bounded_ring<T>    (create())
+        //  - wmp::detail::unbounded_queue<T> (create_unbounded())
+        //  - wmp::detail::sharded_ring<T>    (create_sharded())
+        //  - wmp::detail::priority_ring<T, Levels> (create_priority())
+        //  - wmp::detail::segmented_queue<T> (create_segmented())
+        template <typename T, typename Buffer>
         struct inner
         {
-            SRWLOCK lock;
+            // lock-free storage; senders and the receiver only
+            // touch the members below when the buffer is full / empty
+            Buffer buffer;
+
+            // guards the blocking slow path of senders on a full buffer
+            wmp::detail::srw_lock lock;
+            wmp::detail::cond_var nonfull;
+
+            // number of senders parked on nonfull since the last notification
+            // (low half) and the number of notifications (high half)
+            std::atomic<uint32_t> senders_waiting;
+            // nonzero while the receiver is parked and not yet notified;
+            // the receiver parks directly on this word, so waking it never
+            // requires a sender to acquire the lock
+            std::atomic<uint32_t> receiver_waiting;
+
+            // threads blocked in wmp::select() on the receiver, coroutines
+            // suspended in async_recv(), and the receiver's native handle
+            wmp::detail::waiter_list receiver_waiters;
+            // coroutines suspended in async_send() on a full buffer
+            wmp::detail::waiter_list sender_waiters;
 
-            CONDITION_VARIABLE nonfull;
-            CONDITION_VARIABLE nonempty;
+            // runtime statistics; empty unless WMP_COLLECT_STATS is defined
+            wmp::detail::stats_counters<> stats;
 
-            std::queue<T> buffer;
-            size_t const capacity;
+            // what a send does when the buffer is full; anything but block
+            // requires a bounded_ring (create())
+            overflow const policy;
+            // values discarded under drop_newest or drop_oldest
+            std::atomic<uint64_t> dropped;
 
-            inner(size_t const capacity_) 
-                : lock{}
-                , nonfull{}
-                , nonempty{}
-                , buffer{}
-                , capacity{capacity_} {}
+            template <typename... Args>
+            inner(overflow const policy_, Args&&... args)
+                : buffer{std::forward<Args>(args)...}
+                , senders_waiting{0}
+                , receiver_waiting{0}
+                , policy{policy_}
+                , dropped{0} {}
         };
+
+        // shared_producer - a sender's view of a buffer that all senders push to
+        template <typename Buffer>
+        class shared_producer
+        {
+            Buffer* m_buffer;
+
+        public:
+            explicit shared_producer(Buffer& buffer) noexcept
+                : m_buffer{&buffer} {}
+
+            template <typename U>
+            auto try_push(U&& value) -> bool
+            {
+                return m_buffer->try_push(std::forward<U>(value));
+            }
+
+            template <typename... Args>
+            auto try_emplace(Args&&... args) -> bool
+            {
+                return m_buffer->try_emplace(std::forward<Args>(args)...);
+            }
+
+            template <typename ForwardIt>
+            auto try_push_many(ForwardIt first, ForwardIt last) -> ForwardIt
+            {
+                return m_buffer->try_push_many(first, last);
+            }
+
+            // full() - whether try_push() would fail; bounded buffers only
+            auto full() const noexcept -> bool
+            {
+                return m_buffer->size() >= m_buffer->capacity();
+            }
+        };
+
+        // producer_t - the per-sender handle through which a sender pushes:
+        // Buffer::producer where the buffer has one, shared_producer otherwise
+        template <typename Buffer, typename = void>
+        struct producer_of
+        {
+            using type = shared_producer<Buffer>;
+        };
+
+        template <typename Buffer>
+        struct producer_of<Buffer, std::void_t<typename Buffer::producer>>
+        {
+            using type = typename Buffer::producer;
+        };
+
+        template <typename Buffer>
+        using producer_t = typename producer_of<Buffer>::type;
+
+        // is_prioritized - whether Buffer takes a priority level with each value
+        template <typename Buffer, typename = void>
+        struct is_prioritized : std::false_type {};
+
+        template <typename Buffer>
+        struct is_prioritized<Buffer, std::void_t<decltype(Buffer::levels)>> : std::true_type {};
+
+        // depth() - the number of values in the channel, for statistics
+        template <typename T, typename Buffer>
+        auto depth(inner<T, Buffer> const& shared) -> uint64_t
+        {
+            if constexpr (Buffer::is_bounded)
+            {
+                return shared.buffer.size();
+            }
+            else
+            {
+                // the unbounded queue keeps no count of its own
+                return shared.stats.depth();
+            }
+        }
+
+        // count_sent() - account for `count` values sent, in statistics and traces
+        template <typename T, typename Buffer>
+        auto count_sent(inner<T, Buffer>& shared, std::size_t const count) -> void
+        {
+            using namespace wmp::detail;
+            trace_event(trace_kind::send, trace_source::mpsc, &shared, count);
+
+            if constexpr (wmp::detail::STATS_ENABLED)
+            {
+                shared.stats.add_sent(count);
+                shared.stats.note_depth(depth(shared));
+            }
+        }
+
+        // count_received() - account for `count` values received, in statistics and traces
+        template <typename T, typename Buffer>
+        auto count_received(inner<T, Buffer>& shared, std::size_t const count) -> void
+        {
+            using namespace wmp::detail;
+            trace_event(trace_kind::recv, trace_source::mpsc, &shared, count);
+
+            shared.stats.add_received(count);
+        }
+
+        // evict_oldest() - discard the oldest value to make room, on a drop_oldest channel
+        //
+        // Senders and the receiver then all claim values from the ring with
+        // a CAS on its tail, so eviction never takes a lock.
+        template <typename T, typename Buffer>
+        auto evict_oldest(inner<T, Buffer>& shared) -> void
+        {
+            if constexpr (std::is_same_v<Buffer, wmp::detail::bounded_ring<T>>)
+            {
+                if (shared.buffer.try_pop_shared().has_value())
+                {
+                    shared.dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    // the receiver took the oldest value, but has not yet freed its slot
+                    wmp::detail::cpu_relax();
+                }
+            }
+        }
+
+        // try_push() - enqueue through `attempt` without blocking, applying the overflow policy
+        //
+        // Returns whether the value was enqueued; under drop_oldest it always is.
+        template <typename T, typename Buffer, typename Attempt>
+        auto try_push(inner<T, Buffer>& shared, Attempt&& attempt) -> bool
+        {
+            if (overflow::drop_oldest == shared.policy)
+            {
+                while (!attempt())
+                {
+                    evict_oldest(shared);
+                }
+                return true;
+            }
+
+            if (attempt())
+            {
+                return true;
+            }
+
+            if (overflow::drop_newest == shared.policy)
+            {
+                shared.dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            return false;
+        }
+
+        // pop() - dequeue a value as the receiver
+        template <typename T, typename Buffer>
+        auto pop(inner<T, Buffer>& shared) -> std::optional<T>
+        {
+            if constexpr (std::is_same_v<Buffer, wmp::detail::bounded_ring<T>>)
+            {
+                if (overflow::drop_oldest == shared.policy)
+                {
+                    // senders may be evicting from the same end of the ring
+                    return shared.buffer.try_pop_shared();
+                }
+            }
+
+            return shared.buffer.try_pop();
+        }
+
+        // pop_many() - dequeue up to `max` values through `out` as the receiver
+        template <typename T, typename Buffer, typename OutputIt>
+        auto pop_many(inner<T, Buffer>& shared, OutputIt& out, std::size_t const max) -> std::size_t
+        {
+            if constexpr (std::is_same_v<Buffer, wmp::detail::bounded_ring<T>>)
+            {
+                if (overflow::drop_oldest == shared.policy)
+                {
+                    auto count = std::size_t{0};
+                    for (; count < max; ++count)
+                    {
+                        auto value = shared.buffer.try_pop_shared();
+                        if (!value.has_value())
+                        {
+                            break;
+                        }
+                        *out = std::move(value.value());
+                        ++out;
+                    }
+                    return count;
+                }
+            }
+
+            return shared.buffer.try_pop_many(out, max);
+        }
+
+        // notify_nonempty() - wake the receiver, if it is parked
+        template <typename T, typename Buffer>
+        auto notify_nonempty(inner<T, Buffer>& shared) -> void
+        {
+            // pairs with the fence in await_recv(); either we observe the
+            // receiver's flag or the receiver observes our published value,
+            // and clearing the flag makes the receiver's address wait return
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (shared.receiver_waiting.load(std::memory_order_relaxed) != 0 &&
+                shared.receiver_waiting.exchange(0, std::memory_order_relaxed) != 0)
+            {
+                wmp::detail::wake_address_one(shared.receiver_waiting);
+            }
+
+            // the same fence pairs with the one in wmp::select()
+            shared.receiver_waiters.notify();
+        }
+
+        // notify_nonfull() - wake parked senders, if any
+        //
+        // All parked senders are woken at once and the count is reset, so a
+        // burst of receives costs a single wake rather than one per message;
+        // senders that lose the race for the free slots simply park again.
+        template <typename T, typename Buffer>
+        auto notify_nonfull(inner<T, Buffer>& shared) -> void
+        {
+            using wmp::detail::scoped_srw;
+            using wmp::detail::srw_acquire;
+
+            if constexpr (!Buffer::is_bounded)
+            {
+                // an unbounded buffer never parks senders
+                return;
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto current = shared.senders_waiting.load(std::memory_order_relaxed);
+            while ((current & SENDERS_PARKED) != 0)
+            {
+                if (shared.senders_waiting.compare_exchange_weak(
+                    current, (current & ~SENDERS_PARKED) + SENDERS_EPOCH, std::memory_order_relaxed))
+                {
+                    {
+                        auto guard = scoped_srw{&shared.lock, srw_acquire::exclusive};
+                    }
+                    shared.nonfull.wake_all();
+                    break;
+                }
+            }
+
+            shared.sender_waiters.notify();
+        }
+
+        // retract() - withdraw a sender registration, unless a notification consumed it
+        //
+        // `registered` is the value of senders_waiting just after the
+        // registration was made.
+        inline auto retract(std::atomic<uint32_t>& waiting, uint32_t const registered) -> void
+        {
+            auto current = waiting.load(std::memory_order_relaxed);
+            while (((current ^ registered) & ~SENDERS_PARKED) == 0 && !waiting.compare_exchange_weak(
+                current, current - 1, std::memory_order_relaxed)) {}
+        }
+
+        // await_send() - invoke `attempt` until it reports success or the deadline passes
+        //
+        // Spins briefly, then parks on nonfull between attempts. Returns the
+        // result of the final attempt.
+        template <typename T, typename Buffer, typename Attempt>
+        auto await_send(
+            inner<T, Buffer>&           shared,
+            Attempt&&                   attempt,
+            wmp::detail::deadline const until) -> bool
+        {
+            using wmp::detail::unique_srw;
+            using wmp::detail::srw_acquire;
+
+            for (auto spins = 0u; spins < wmp::detail::SPIN_LIMIT; ++spins)
+            {
+                if (attempt())
+                {
+                    return true;
+                }
+                wmp::detail::cpu_relax();
+            }
+
+            auto done = false;
+            auto lock = unique_srw{&shared.lock, srw_acquire::exclusive};
+            auto registered = shared.senders_waiting.fetch_add(1, std::memory_order_relaxed) + 1;
+            for (;;)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if ((done = attempt()))
+                {
+                    break;
+                }
+
+                auto const woken = shared.stats.block(wmp::detail::blocked_side::sender, [&]() {
+                    return shared.nonfull.sleep(shared.lock, srw_acquire::exclusive, until);
+                });
+
+                if (!woken)
+                {
+                    done = attempt();
+                    break;
+                }
+
+                // register again only if a notification consumed the
+                // registration; a spurious wake leaves it in place
+                auto const current = shared.senders_waiting.load(std::memory_order_relaxed);
+                if (((current ^ registered) & ~SENDERS_PARKED) != 0)
+                {
+                    registered = shared.senders_waiting.fetch_add(1, std::memory_order_relaxed) + 1;
+                }
+            }
+
+            retract(shared.senders_waiting, registered);
+            return done;
+        }
+
+        // await_recv() - invoke `attempt` until it reports success or the deadline passes
+        //
+        // Spins briefly, then parks on the receiver_waiting word between
+        // attempts. Returns the result of the final attempt.
+        template <typename T, typename Buffer, typename Attempt>
+        auto await_recv(
+            inner<T, Buffer>&           shared,
+            Attempt&&                   attempt,
+            wmp::detail::deadline const until) -> bool
+        {
+            for (auto spins = 0u; spins < wmp::detail::SPIN_LIMIT; ++spins)
+            {
+                if (attempt())
+                {
+                    return true;
+                }
+                wmp::detail::cpu_relax();
+            }
+
+            auto done = false;
+            for (;;)
+            {
+                shared.receiver_waiting.store(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if ((done = attempt()))
+                {
+                    break;
+                }
+
+                auto const woken = shared.stats.block(wmp::detail::blocked_side::receiver, [&]() {
+                    return wmp::detail::wait_on_address(shared.receiver_waiting, 1, until);
+                });
+
+                if (!woken)
+                {
+                    done = attempt();
+                    break;
+                }
+            }
+
+            shared.receiver_waiting.store(0, std::memory_order_relaxed);
+            return done;
+        }
+
     }
 
     // ------------------------------------------------------------------------
@@ -48,48 +468,56 @@ namespace wmp::mpsc
         timeout
     };
 
-    template <typename T>
+    template <typename T, typename Buffer = wmp::detail::bounded_ring<T>>
     class sender
     {
-        std::shared_ptr<detail::inner<T>> m_inner;
+        std::shared_ptr<detail::inner<T, Buffer>> m_inner;
+        // declared after m_inner: released while the buffer is still alive
+        detail::producer_t<Buffer> m_producer;
 
     public:
-        sender(std::shared_ptr<detail::inner<T>> inner)
+        sender(std::shared_ptr<detail::inner<T, Buffer>> inner)
             : m_inner{inner}
+            , m_producer{inner->buffer}
         {}
 
         // non-copyable, outside explicit clone()
         sender(sender const&) = delete;
         sender& operator=(sender const&) = delete;
 
-        // default movable
-        sender(sender&&)            = default;
-        sender& operator=(sender&&) = default;
+        sender(sender&&) = default;
 
-        auto clone() -> sender<T>
+        // releases the producer before the buffer it belongs to
+        sender& operator=(sender&& other) noexcept
+        {
+            m_producer = std::move(other.m_producer);
+            m_inner    = std::move(other.m_inner);
+            return *this;
+        }
+
+        auto clone() -> sender<T, Buffer>
         {
             return sender{m_inner};
         }
 
         // send() - blocking send operation (indefinite timeout)
+        //
+        // On a channel created with a lossy overflow policy, sends never
+        // block: they behave as try_send().
         auto send(T value) -> send_result
         {
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
-
+            if (overflow::block != m_inner->policy)
             {
-                auto lock = unique_srw{&m_inner->lock, srw_acquire::exclusive};
-                
-                // block until we acquire exclusive access on nonfull buffer
-                while (m_inner->buffer.size() >= m_inner->capacity)
-                {
-                    ::SleepConditionVariableSRW(&m_inner->nonfull, &m_inner->lock, INFINITE, 0);
-                }
-
-                m_inner->buffer.push(value);
+                return try_send(std::move(value));
             }
 
-            ::WakeConditionVariable(&m_inner->nonempty);
+            detail::await_send(
+                *m_inner,
+                [&]() { return m_producer.try_push(std::move(value)); },
+                wmp::detail::deadline::never());
+
+            detail::count_sent(*m_inner, 1);
+            detail::notify_nonempty(*m_inner);
             return send_result::success;
         }
 
@@ -97,118 +525,319 @@ namespace wmp::mpsc
         template <typename Duration>
         auto send_timeout(T value, Duration timeout) -> send_result
         {
-            using namespace std::chrono;
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
+            return send_by(std::move(value), wmp::detail::deadline::after(timeout));
+        }
+
+        // send_until() - blocking send operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto send_until(T value, std::chrono::time_point<Clock, Duration> const& deadline) -> send_result
+        {
+            return send_by(std::move(value), wmp::detail::deadline::at(deadline));
+        }
+
+        // try_send() - non-blocking send operation
+        //
+        // Fails if the channel is full, or under drop_newest discards the
+        // value; under drop_oldest always succeeds.
+        auto try_send(T value) -> send_result
+        {
+            if (detail::try_push(*m_inner, [&]() { return m_producer.try_push(std::move(value)); }))
+            {
+                detail::count_sent(*m_inner, 1);
+                detail::notify_nonempty(*m_inner);
+                return send_result::success;
+            }
+
+            return send_result::failure;
+        }
+
+        // send() - blocking send operation at `priority` (indefinite timeout)
+        //
+        // Priority channels only (create_priority()): the receiver takes
+        // values from higher priorities first, and the plain overloads send
+        // at the lowest priority, 0.
+        auto send(T value, std::size_t const priority) -> send_result
+        {
+            static_assert(detail::is_prioritized<Buffer>::value, "send() with a priority requires create_priority()");
 
-            auto const ms = static_cast<unsigned long>(
-                duration_cast<milliseconds>(timeout).count());
+            detail::await_send(
+                *m_inner,
+                [&]() { return m_producer.try_push(priority, std::move(value)); },
+                wmp::detail::deadline::never());
 
-            auto error = ERROR_SUCCESS;
+            detail::count_sent(*m_inner, 1);
+            detail::notify_nonempty(*m_inner);
+            return send_result::success;
+        }
+
+        // send_timeout() - blocking send operation at `priority` with timeout
+        template <typename Duration>
+        auto send_timeout(T value, std::size_t const priority, Duration timeout) -> send_result
+        {
+            static_assert(detail::is_prioritized<Buffer>::value, "send_timeout() with a priority requires create_priority()");
+
+            return send_by(std::move(value), priority, wmp::detail::deadline::after(timeout));
+        }
+
+        // send_until() - blocking send operation at `priority` with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto send_until(T value, std::size_t const priority, std::chrono::time_point<Clock, Duration> const& deadline) -> send_result
+        {
+            static_assert(detail::is_prioritized<Buffer>::value, "send_until() with a priority requires create_priority()");
+
+            return send_by(std::move(value), priority, wmp::detail::deadline::at(deadline));
+        }
+
+        // try_send() - non-blocking send operation at `priority`
+        auto try_send(T value, std::size_t const priority) -> send_result
+        {
+            static_assert(detail::is_prioritized<Buffer>::value, "try_send() with a priority requires create_priority()");
 
+            if (m_producer.try_push(priority, std::move(value)))
             {
-                auto lock = unique_srw{&m_inner->lock, srw_acquire::exclusive};
-                
-                // block until we acquire exclusive access on nonfull buffer
-                while (m_inner->buffer.size() >= m_inner->capacity && error != ERROR_TIMEOUT)
-                {
-                    if (!::SleepConditionVariableSRW(
-                        &m_inner->nonfull, 
-                        &m_inner->lock, 
-                        ms,
-                        0))
+                detail::count_sent(*m_inner, 1);
+                detail::notify_nonempty(*m_inner);
+                return send_result::success;
+            }
+
+            return send_result::failure;
+        }
+
+        // emplace_send() - blocking send of a value constructed in place
+        //
+        // The value is constructed from `args` directly in channel storage,
+        // once space is available; no temporary T is ever created.
+        template <typename... Args>
+        auto emplace_send(Args&&... args) -> send_result
+        {
+            if (overflow::block != m_inner->policy)
+            {
+                return try_emplace_send(std::forward<Args>(args)...);
+            }
+
+            detail::await_send(
+                *m_inner,
+                [&]() { return m_producer.try_emplace(std::forward<Args>(args)...); },
+                wmp::detail::deadline::never());
+
+            detail::count_sent(*m_inner, 1);
+            detail::notify_nonempty(*m_inner);
+            return send_result::success;
+        }
+
+        // try_emplace_send() - non-blocking send of a value constructed in place
+        template <typename... Args>
+        auto try_emplace_send(Args&&... args) -> send_result
+        {
+            if (detail::try_push(*m_inner, [&]() { return m_producer.try_emplace(std::forward<Args>(args)...); }))
+            {
+                detail::count_sent(*m_inner, 1);
+                detail::notify_nonempty(*m_inner);
+                return send_result::success;
+            }
+
+            return send_result::failure;
+        }
+
+        // send_many() - blocking send of every value in [first, last)
+        //
+        // Values are enqueued in batches, each claimed with a single atomic
+        // operation and followed by (at most) a single wake of the receiver.
+        // Values are copied from `*first`; pass move iterators to move them.
+        template <typename ForwardIt>
+        auto send_many(ForwardIt first, ForwardIt last) -> send_result
+        {
+            if (overflow::block != m_inner->policy)
+            {
+                auto const count = static_cast<std::size_t>(std::distance(first, last));
+                return count == try_send_many(first, last) ? send_result::success : send_result::failure;
+            }
+
+            detail::await_send(
+                *m_inner,
+                [&]() {
+                    auto const next = m_producer.try_push_many(first, last);
+                    if (next != first)
                     {
-                        error = ::GetLastError();
+                        // publish partial progress before (possibly) parking
+                        detail::count_sent(*m_inner, static_cast<std::size_t>(std::distance(first, next)));
+                        first = next;
+                        detail::notify_nonempty(*m_inner);
                     }
-                }
+                    return first == last;
+                },
+                wmp::detail::deadline::never());
 
-                if (ERROR_SUCCESS == error)
+            return send_result::success;
+        }
+
+        // try_send_many() - non-blocking send of a prefix of [first, last)
+        //
+        // Enqueues as many values as currently fit and returns how many;
+        // under drop_newest the rest are discarded, under drop_oldest older
+        // values are discarded to make room for all of them.
+        template <typename ForwardIt>
+        auto try_send_many(ForwardIt first, ForwardIt last) -> std::size_t
+        {
+            auto next = m_producer.try_push_many(first, last);
+            if (overflow::drop_oldest == m_inner->policy)
+            {
+                while (next != last)
                 {
-                    // successfully acquired exclusive access to nonfull buffer
-                    m_inner->buffer.push(value);
+                    detail::evict_oldest(*m_inner);
+                    next = m_producer.try_push_many(next, last);
                 }
             }
-
-            if (ERROR_SUCCESS == error)
+            else if (overflow::drop_newest == m_inner->policy)
             {
-                ::WakeConditionVariable(&m_inner->nonempty);
-                return send_result::success;
+                m_inner->dropped.fetch_add(
+                    static_cast<uint64_t>(std::distance(next, last)), std::memory_order_relaxed);
             }
-            else
+
+            auto const sent = static_cast<std::size_t>(std::distance(first, next));
+            if (sent > 0)
             {
-                return send_result::timeout;
+                detail::count_sent(*m_inner, sent);
+                detail::notify_nonempty(*m_inner);
             }
+
+            return sent;
         }
 
-        // try_send() - non-blocking send operation
-        auto try_send(T value) -> send_result
+#if defined(WMP_COLLECT_STATS)
+        // stats() - a snapshot of the channel's runtime statistics
+        auto stats() const -> wmp::channel_stats
         {
-            using wmp::detail::scoped_srw;
-            using wmp::detail::srw_acquire;
+            return m_inner->stats.snapshot(detail::depth(*m_inner));
+        }
+#endif
 
-            auto sent = false;
+#if WMP_HAS_COROUTINES
+        // async_send() - send operation that suspends the calling coroutine
+        //
+        // The returned task completes once the value is enqueued. A coroutine
+        // that finds the buffer full is suspended, not parked, and resumed on
+        // `executor` once the receiver frees space. The sender must outlive
+        // the task.
+        template <typename Executor>
+        auto async_send(T value, Executor& executor) -> wmp::detail::task<send_result>
+        {
+            if (overflow::block != m_inner->policy)
+            {
+                co_return try_send(std::move(value));
+            }
 
+            for (;;)
             {
-                auto guard = scoped_srw{&m_inner->lock, srw_acquire::exclusive};
-                if (m_inner->buffer.size() < m_inner->capacity)
+                if (m_producer.try_push(std::move(value)))
                 {
-                    m_inner->buffer.push(value);
-                    sent = true;
+                    detail::count_sent(*m_inner, 1);
+                    detail::notify_nonempty(*m_inner);
+                    co_return send_result::success;
                 }
+
+                if constexpr (Buffer::is_bounded)
+                {
+                    co_await wmp::detail::readiness{
+                        m_inner->sender_waiters,
+                        executor,
+                        [this]() { return !m_producer.full(); }};
+                }
+            }
+        }
+#endif
+
+    private:
+        auto send_by(T&& value, wmp::detail::deadline const until) -> send_result
+        {
+            if (overflow::block != m_inner->policy)
+            {
+                return try_send(std::move(value));
             }
 
-            if (sent)
+            auto const sent = detail::await_send(
+                *m_inner,
+                [&]() { return m_producer.try_push(std::move(value)); },
+                until);
+
+            if (!sent)
             {
-                ::WakeConditionVariable(&m_inner->nonempty);
+                return send_result::timeout;
             }
 
-            return sent ? send_result::success : send_result::failure;
+            detail::count_sent(*m_inner, 1);
+            detail::notify_nonempty(*m_inner);
+            return send_result::success;
+        }
+
+        auto send_by(T&& value, std::size_t const priority, wmp::detail::deadline const until) -> send_result
+        {
+            auto const sent = detail::await_send(
+                *m_inner,
+                [&]() { return m_producer.try_push(priority, std::move(value)); },
+                until);
+
+            if (!sent)
+            {
+                return send_result::timeout;
+            }
+
+            detail::count_sent(*m_inner, 1);
+            detail::notify_nonempty(*m_inner);
+            return send_result::success;
         }
     };
 
     // ------------------------------------------------------------------------
     // receiver
 
-    template <typename T>
+    template <typename T, typename Buffer = wmp::detail::bounded_ring<T>>
     class receiver
     {
-        std::shared_ptr<detail::inner<T>> m_inner;
+        std::shared_ptr<detail::inner<T, Buffer>> m_inner;
+
+        // created on the first call to native_handle(); declared after
+        // m_inner so that it is destroyed (and deregistered) first
+        std::unique_ptr<wmp::detail::pollable> m_pollable;
 
     public:
-        receiver(std::shared_ptr<detail::inner<T>> inner)
+        using native_handle_type = wmp::detail::native_event::native_handle_type;
+
+        receiver(std::shared_ptr<detail::inner<T, Buffer>> inner)
             : m_inner{inner}
+            , m_pollable{}
         {}
 
         // non-copyable
         receiver(receiver const&)            = delete;
         receiver& operator=(receiver const&) = delete;
 
-        // default movable
-        receiver(receiver&&)            = default;
-        receiver& operator=(receiver&&) = default;
+        receiver(receiver&&) = default;
+
+        // deregisters the native handle while its waiter list is still alive
+        receiver& operator=(receiver&& other) noexcept
+        {
+            if (this != &other)
+            {
+                m_pollable.reset();
+                m_inner    = std::move(other.m_inner);
+                m_pollable = std::move(other.m_pollable);
+            }
+            return *this;
+        }
 
         // recv() - blocking receive operation (indefinite timeout)
         auto recv() -> std::optional<T>
         {
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
-
             auto value = std::optional<T>{};  // std::nullopt
 
-            {
-                auto lock = unique_srw{&m_inner->lock, srw_acquire::exclusive};
-
-                // block until we acquire exclusive access to nonempty buffer
-                while (m_inner->buffer.size() == 0)
-                {
-                    ::SleepConditionVariableSRW(&m_inner->nonempty, &m_inner->lock, INFINITE, 0);
-                }
-
-                value.emplace(m_inner->buffer.front());
-                m_inner->buffer.pop();
-            }
+            detail::await_recv(
+                *m_inner,
+                [&]() { return (value = detail::pop(*m_inner)).has_value(); },
+                wmp::detail::deadline::never());
 
-            ::WakeConditionVariable(&m_inner->nonfull);
+            detail::count_received(*m_inner, 1);
+            detail::notify_nonfull(*m_inner);
             return value;
         }
 
@@ -216,82 +845,392 @@ namespace wmp::mpsc
         template <typename Duration>
         auto recv_timeout(Duration timeout) -> std::optional<T>
         {
-            using namespace std::chrono;
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
+            return recv_by(wmp::detail::deadline::after(timeout));
+        }
 
-            auto ms = static_cast<unsigned long>(
-                duration_cast<milliseconds>(timeout).count());
+        // recv_until() - blocking receive operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto recv_until(std::chrono::time_point<Clock, Duration> const& deadline) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::at(deadline));
+        }
+
+        // try_recv() - non-blocking receive operation
+        auto try_recv() -> std::optional<T>
+        {
+            auto value = detail::pop(*m_inner);
+            if (value.has_value())
+            {
+                detail::count_received(*m_inner, 1);
+                detail::notify_nonfull(*m_inner);
+            }
+            else
+            {
+                rearm();
+            }
 
-            auto value = std::optional<T>{};  // std::nullopt 
-            auto error = ERROR_SUCCESS;
+            return value;
+        }
 
+        // recv_many() - blocking receive of up to `max` values
+        //
+        // Blocks until at least one value is available, then moves every
+        // available value (up to `max`) through `out` and returns the count.
+        // Senders parked on a full buffer are woken at most once per batch.
+        template <typename OutputIt>
+        auto recv_many(OutputIt out, std::size_t const max) -> std::size_t
+        {
+            if (0 == max)
             {
-                auto lock = unique_srw{&m_inner->lock, srw_acquire::exclusive};
-                while (m_inner->buffer.size() == 0 && error != ERROR_TIMEOUT)
-                {
-                    if (!::SleepConditionVariableSRW(
-                        &m_inner->nonempty,
-                        &m_inner->lock,
-                        ms,
-                        0))
-                    {
-                        error = ::GetLastError();
-                    }
+                return 0;
+            }
 
-                    if (ERROR_SUCCESS == error)
-                    {
-                        // successfully acquired exclusive access to nonempty buffer
-                        value.emplace(m_inner->buffer.front());
-                        m_inner->buffer.pop();
-                    }
-                }
+            auto count = std::size_t{0};
+
+            detail::await_recv(
+                *m_inner,
+                [&]() { return (count = detail::pop_many(*m_inner, out, max)) > 0; },
+                wmp::detail::deadline::never());
+
+            detail::count_received(*m_inner, count);
+            detail::notify_nonfull(*m_inner);
+            return count;
+        }
+
+        // try_recv_many() - non-blocking receive of up to `max` values
+        template <typename OutputIt>
+        auto try_recv_many(OutputIt out, std::size_t const max) -> std::size_t
+        {
+            auto const count = detail::pop_many(*m_inner, out, max);
+            if (count > 0)
+            {
+                detail::count_received(*m_inner, count);
+                detail::notify_nonfull(*m_inner);
             }
 
-            if (ERROR_SUCCESS == error)
+            if (count < max)
             {
-                ::WakeConditionVariable(&m_inner->nonfull);
+                rearm();
             }
 
-            return value;
+            return count;
         }
 
-        // try_recv() - non-blocking receive operation
-        auto try_recv() -> std::optional<T>
+        // drain() - non-blocking receive of every value currently in the channel
+        //
+        // Equivalent to try_recv_many() without an upper bound.
+        template <typename OutputIt>
+        auto drain(OutputIt out) -> std::size_t
         {
-            using wmp::detail::scoped_srw;
-            using wmp::detail::srw_acquire;
-            
-            auto value   = std::optional<T>{};  // std::nullopt
-            auto removed = false;
+            return try_recv_many(out, std::numeric_limits<std::size_t>::max());
+        }
 
+        // ready() - whether a value is available, so that try_recv() would succeed
+        auto ready() const -> bool
+        {
+            return !m_inner->buffer.empty();
+        }
+
+        // footprint() - the number of bytes of message storage the channel currently holds
+        //
+        // Segmented channels only (create_segmented()).
+        auto footprint() const noexcept -> std::size_t
+        {
+            return m_inner->buffer.footprint();
+        }
+
+        // dropped() - the number of values discarded under a lossy overflow policy
+        auto dropped() const noexcept -> uint64_t
+        {
+            return m_inner->dropped.load(std::memory_order_relaxed);
+        }
+
+        // native_handle() - a handle that the platform's wait facilities can wait on
+        //
+        // The handle (an eventfd on Linux, an event object on Windows) is
+        // signaled while a value is available, so the receiver can be polled
+        // alongside sockets and other handles; once signaled, consume values
+        // with try_recv() / drain() until the channel is found empty, which
+        // clears the signal. Senders only touch the handle when the channel
+        // goes from empty to non-empty. The handle is created on first use
+        // and remains owned by the receiver.
+        auto native_handle() -> native_handle_type
+        {
+            if (!m_pollable)
             {
-                auto guard = scoped_srw{&m_inner->lock, srw_acquire::exclusive};
-                if (m_inner->buffer.size() > 0)
-                {
-                    value.emplace(m_inner->buffer.front());
-                    m_inner->buffer.pop();
+                m_pollable = std::make_unique<wmp::detail::pollable>(m_inner->receiver_waiters);
+
+                // values sent before the handle existed never signaled it
+                rearm();
+            }
 
-                    removed = true;
+            return m_pollable->native_handle();
+        }
+
+#if defined(WMP_COLLECT_STATS)
+        // stats() - a snapshot of the channel's runtime statistics
+        auto stats() const -> wmp::channel_stats
+        {
+            return m_inner->stats.snapshot(detail::depth(*m_inner));
+        }
+#endif
+
+#if WMP_HAS_COROUTINES
+        // async_recv() - receive operation that suspends the calling coroutine
+        //
+        // The returned task completes with the next value. A coroutine that
+        // finds the channel empty is suspended, not parked, and resumed on
+        // `executor` once a value arrives. The receiver must outlive the task.
+        template <typename Executor>
+        auto async_recv(Executor& executor) -> wmp::detail::task<std::optional<T>>
+        {
+            for (;;)
+            {
+                if (auto value = try_recv(); value.has_value())
+                {
+                    co_return std::move(value);
                 }
+
+                co_await wmp::detail::readiness{
+                    m_inner->receiver_waiters, executor, [this]() { return ready(); }};
             }
+        }
+#endif
+
+    private:
+        friend struct wmp::detail::select_access;
+
+        auto select_waiters() -> wmp::detail::waiter_list&
+        {
+            return m_inner->receiver_waiters;
+        }
+
+        auto recv_by(wmp::detail::deadline const until) -> std::optional<T>
+        {
+            auto value = std::optional<T>{};  // std::nullopt
 
-            if (removed)
+            auto const received = detail::await_recv(
+                *m_inner,
+                [&]() { return (value = detail::pop(*m_inner)).has_value(); },
+                until);
+
+            if (received)
             {
-                ::WakeConditionVariable(&m_inner->nonfull);
+                detail::count_received(*m_inner, 1);
+                detail::notify_nonfull(*m_inner);
             }
 
             return value;
         }
+
+        // rearm() - clear the native handle's signal once the channel is found empty
+        auto rearm() -> void
+        {
+            if (m_pollable)
+            {
+                m_pollable->rearm([this]() { return ready(); });
+            }
+        }
     };
 
     // ------------------------------------------------------------------------
     // create()
 
+    // create() - construct a new bounded mpsc channel
+    //
+    // The channel is backed by a lock-free ring; the requested capacity
+    // is rounded up to the next power of two. `policy` decides what a send
+    // does when the channel is full: under drop_newest and drop_oldest
+    // sends never block, the value sent or the oldest value in the channel
+    // is discarded instead, and receiver::dropped() counts the discards.
+    template <typename T>
+    auto create(size_t const capacity, overflow const policy = overflow::block) -> std::pair<sender<T>, receiver<T>>
+    {
+        using buffer = wmp::detail::bounded_ring<T>;
+        auto shared_inner = std::make_shared<detail::inner<T, buffer>>(policy, capacity);
+        return std::pair{ sender<T>{shared_inner}, receiver<T>{shared_inner} };
+    }
+
+    // ------------------------------------------------------------------------
+    // create_unbounded()
+
+    template <typename T>
+    using unbounded_sender = sender<T, wmp::detail::unbounded_queue<T>>;
+
+    template <typename T>
+    using unbounded_receiver = receiver<T, wmp::detail::unbounded_queue<T>>;
+
+    // create_unbounded() - construct a new unbounded mpsc channel
+    //
+    // The channel is backed by a linked-node queue: send(), send_timeout()
+    // and try_send() never block, never fail, and never acquire a lock;
+    // only the receiver parks, and only when the queue is empty.
+    template <typename T>
+    auto create_unbounded() -> std::pair<unbounded_sender<T>, unbounded_receiver<T>>
+    {
+        using buffer = wmp::detail::unbounded_queue<T>;
+        auto shared_inner = std::make_shared<detail::inner<T, buffer>>(overflow::block);
+        return std::pair{ unbounded_sender<T>{shared_inner}, unbounded_receiver<T>{shared_inner} };
+    }
+
+    // ------------------------------------------------------------------------
+    // create_sharded()
+
     template <typename T>
-    auto create(size_t const capacity) -> std::pair<sender<T>, receiver<T>> 
+    using sharded_sender = sender<T, wmp::detail::sharded_ring<T>>;
+
+    template <typename T>
+    using sharded_receiver = receiver<T, wmp::detail::sharded_ring<T>>;
+
+    // create_sharded() - construct a new bounded mpsc channel with a queue per sender
+    //
+    // Every sender (the one returned, and each clone()) pushes to a
+    // single-producer ring of its own holding `capacity` values, rounded up
+    // to the next power of two, so senders never contend with one another
+    // however many there are. The receiver takes values from the rings in
+    // round-robin order: values from one sender are received in the order
+    // sent, values from different senders are interleaved. A sender blocks
+    // only when its own ring is full.
+    template <typename T>
+    auto create_sharded(size_t const capacity) -> std::pair<sharded_sender<T>, sharded_receiver<T>>
+    {
+        using buffer = wmp::detail::sharded_ring<T>;
+        auto shared_inner = std::make_shared<detail::inner<T, buffer>>(overflow::block, capacity);
+        return std::pair{ sharded_sender<T>{shared_inner}, sharded_receiver<T>{shared_inner} };
+    }
+
+    // ------------------------------------------------------------------------
+    // create_segmented()
+
+    // segment_pool - a recycling allocator for the storage segments of segmented channels
+    //
+    // A segmented channel returns each segment to its pool as soon as the
+    // receiver has drained it, and takes segments from the pool as a burst
+    // of sends needs them; each thread recycles segments through its own
+    // free list. The pool must outlive every channel created from it.
+    template <typename T>
+    class segment_pool
+    {
+        wmp::detail::slab_pool m_slab;
+
+        template <typename U>
+        friend auto create_segmented(segment_pool<U>& p)
+            -> std::pair<sender<U, wmp::detail::segmented_queue<U>>, receiver<U, wmp::detail::segmented_queue<U>>>;
+
+    public:
+        segment_pool() = default;
+
+        // non-copyable
+        segment_pool(segment_pool const&)            = delete;
+        segment_pool& operator=(segment_pool const&) = delete;
+
+        // non-movable
+        segment_pool(segment_pool&&)            = delete;
+        segment_pool& operator=(segment_pool&&) = delete;
+
+        // available() - the number of released segments held for reuse
+        auto available() -> std::size_t
+        {
+            return m_slab.available();
+        }
+
+        // trim() - return the segments held for reuse by the pool and the
+        // calling thread to the heap
+        auto trim() -> void
+        {
+            m_slab.trim();
+        }
+
+        // shared() - the pool used by create_segmented() without a pool;
+        // never destroyed, so that channels may outlive static destruction
+        static auto shared() -> segment_pool&
+        {
+            static auto* const pool = new segment_pool{};
+            return *pool;
+        }
+    };
+
+    template <typename T>
+    using segmented_sender = sender<T, wmp::detail::segmented_queue<T>>;
+
+    template <typename T>
+    using segmented_receiver = receiver<T, wmp::detail::segmented_queue<T>>;
+
+    // create_segmented() - construct a new unbounded mpsc channel with storage drawn from `p`
+    //
+    // The channel stores values in segments of a fixed size, allocated from
+    // `p` as sends need them and returned to it as soon as the receiver has
+    // drained them, so a channel that has been idle holds a single segment
+    // however large its last burst was. As with create_unbounded(), sends
+    // never block and never fail. receiver::footprint() reports the storage
+    // the channel currently holds.
+    template <typename T>
+    auto create_segmented(segment_pool<T>& p) -> std::pair<segmented_sender<T>, segmented_receiver<T>>
+    {
+        using buffer = wmp::detail::segmented_queue<T>;
+        auto shared_inner = std::make_shared<detail::inner<T, buffer>>(overflow::block, p.m_slab);
+        return std::pair{ segmented_sender<T>{shared_inner}, segmented_receiver<T>{shared_inner} };
+    }
+
+    // create_segmented() - construct a new segmented channel drawing from the shared pool
+    template <typename T>
+    auto create_segmented() -> std::pair<segmented_sender<T>, segmented_receiver<T>>
+    {
+        return create_segmented<T>(segment_pool<T>::shared());
+    }
+
+    // ------------------------------------------------------------------------
+    // create_priority()
+
+    template <typename T, std::size_t Levels>
+    using priority_sender = sender<T, wmp::detail::priority_ring<T, Levels>>;
+
+    template <typename T, std::size_t Levels>
+    using priority_receiver = receiver<T, wmp::detail::priority_ring<T, Levels>>;
+
+    // create_priority() - construct a new bounded mpsc channel with `Levels` priorities
+    //
+    // Senders pass a priority in [0, Levels) to send(), send_timeout(),
+    // send_until() and try_send(); the receiver always takes the oldest
+    // value of the highest priority holding any. Every priority is a
+    // lock-free ring of its own with room for `capacity` values, rounded up
+    // to the next power of two, so a backlog at one priority never blocks
+    // senders at another. At most 64 priorities are supported.
+    template <typename T, std::size_t Levels>
+    auto create_priority(size_t const capacity) -> std::pair<priority_sender<T, Levels>, priority_receiver<T, Levels>>
+    {
+        using buffer = wmp::detail::priority_ring<T, Levels>;
+        auto shared_inner = std::make_shared<detail::inner<T, buffer>>(overflow::block, capacity);
+        return std::pair{ priority_sender<T, Levels>{shared_inner}, priority_receiver<T, Levels>{shared_inner} };
+    }
+
+    // ------------------------------------------------------------------------
+    // create_any()
+
+    // any_message - a message of any type, held in place if it fits in MaxInlineSize bytes
+    template <std::size_t MaxInlineSize>
+    using any_message = wmp::detail::inline_any<MaxInlineSize>;
+
+    template <std::size_t MaxInlineSize>
+    using any_sender = sender<any_message<MaxInlineSize>>;
+
+    template <std::size_t MaxInlineSize>
+    using any_receiver = receiver<any_message<MaxInlineSize>>;
+
+    // create_any() - construct a new bounded mpsc channel for messages of any type
+    //
+    // Every slot of the channel holds an any_message<MaxInlineSize>: a
+    // message of up to MaxInlineSize bytes (and no more than max_align_t
+    // aligned, and nothrow movable) is stored in the slot itself, and only
+    // larger messages are allocated on the heap. Messages of any type may be
+    // passed to send() as they are; emplace_send(std::in_place_type<M>, ...)
+    // constructs one directly in its slot. The receiver dispatches on the
+    // type of each message with any_message::visit<Ms...>(visitor), or tests
+    // and accesses it with is<M>() and get<M>(). `policy` is as for create().
+    template <std::size_t MaxInlineSize>
+    auto create_any(size_t const capacity, overflow const policy = overflow::block)
+        -> std::pair<any_sender<MaxInlineSize>, any_receiver<MaxInlineSize>>
     {
-        auto shared_inner = std::make_shared<detail::inner<T>>(capacity);
-        return std::pair{ sender{shared_inner}, receiver{shared_inner} };
+        return create<any_message<MaxInlineSize>>(capacity, policy);
     }
-}
\ No newline at end of file
+}
@@ -2,12 +2,23 @@
 
 #pragma once
 
+#include <new>
 #include <tuple>
+#include <atomic>
 #include <memory>
+#include <chrono>
+#include <cstdint>
+#include <utility>
 #include <optional>
 
-#include "detail/scoped_srw.hpp"
-#include "detail/unique_srw.hpp"
+#include "detail/spin.hpp"
+#include "detail/coro.hpp"
+#include "detail/stats.hpp"
+#include "detail/trace.hpp"
+#include "detail/backend.hpp"
+#include "detail/waiter.hpp"
+#include "detail/pollable.hpp"
+#include "detail/slab_pool.hpp"
 
 namespace wmp::oneshot
 {
@@ -16,27 +27,27 @@ namespace wmp::oneshot
 
     namespace detail
     {
-        enum class state
-        {
-            init,
-            sent,
-            wait_send,
-            wait_recv,
-            closed,
-            closed_recv
-        };
-
-        auto swap_state(state& current, state updated) -> state
-        {
-            auto const tmp = current;
-            current = updated;
-            return tmp;
-        }
-
-        auto is_closed(state const s) -> bool
-        {
-            return state::closed == s || state::closed_recv == s;
-        }
+        // The entire channel state is a set of flags in a single atomic word;
+        // every transition is a CAS on that word, and a thread that must wait
+        // parks on the word itself. At most one thread is ever parked:
+        // the receiver only parks before a value is sent, the sender (in
+        // send_sync()) only after.
+        using state = uint32_t;
+
+        // a value is constructed in the channel's storage
+        constexpr static state const VALUE       = 1u << 0;
+        // the receiver took the value
+        constexpr static state const RECEIVED    = 1u << 1;
+        // the receiver is parked, waiting for a value
+        constexpr static state const RX_WAITING  = 1u << 2;
+        // the sender is parked in send_sync(), waiting for the receiver
+        constexpr static state const TX_WAITING  = 1u << 3;
+        // the sender has closed (or dropped) its handle
+        constexpr static state const TX_CLOSED   = 1u << 4;
+        // the receiver has closed (or dropped) its handle
+        constexpr static state const RX_CLOSED   = 1u << 5;
+
+        constexpr static state const INIT = 0;
     }
 
     // ------------------------------------------------------------------------
@@ -47,38 +58,93 @@ namespace wmp::oneshot
         template<typename T>
         struct inner
         {
-            // mutual exclusion
-            SRWLOCK lock;
+            std::atomic<detail::state> state;
 
-            // notified upon receiver drop
-            CONDITION_VARIABLE tx_cv;
-            // notified upon sender send()
-            CONDITION_VARIABLE rx_cv;
+            // holds a T while VALUE is set
+            alignas(T) unsigned char storage[sizeof(T)];
 
-            state state;
+            // threads blocked in wmp::select() on the receiver, coroutines
+            // suspended in async_recv(), and the receiver's native handle
+            wmp::detail::waiter_list waiters;
 
-            std::optional<T> value;
+            // runtime statistics; empty unless WMP_COLLECT_STATS is defined;
+            // a single shard suffices for one sender and one receiver
+            wmp::detail::stats_counters<1> stats;
 
             inner()
-                : lock{}
-                , tx_cv{}
-                , rx_cv{}
-                , state{state::init}
-                , value{std::nullopt}
+                : state{INIT} {}
+
+            ~inner()
             {
-                ::InitializeSRWLock(&lock);
-                ::InitializeConditionVariable(&tx_cv);
-                ::InitializeConditionVariable(&rx_cv);
+                // a value that was sent but never received
+                if (state.load(std::memory_order_acquire) & VALUE)
+                {
+                    value()->~T();
+                }
             }
 
-            ~inner() = default;
-
             inner(inner const&)            = delete;
             inner& operator=(inner const&) = delete;
 
             inner(inner&&)            = delete;
             inner& operator=(inner&&) = delete;
+
+            auto value() noexcept -> T*
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
         };
+
+        // wake() - wake the peer parked on the state word
+        template <typename T>
+        auto wake(inner<T>& shared) -> void
+        {
+            wmp::detail::wake_address_one(shared.state);
+        }
+
+        // park() - wait until the state word no longer holds `current`, or until the deadline
+        //
+        // Spins briefly before parking; the caller re-examines the state on return.
+        template <typename T>
+        auto park(
+            inner<T>&                       shared,
+            state const                     current,
+            wmp::detail::blocked_side const side,
+            wmp::detail::deadline const     until = wmp::detail::deadline::never()) -> void
+        {
+            for (auto spins = 0u; spins < wmp::detail::SPIN_LIMIT; ++spins)
+            {
+                if (shared.state.load(std::memory_order_acquire) != current)
+                {
+                    return;
+                }
+                wmp::detail::cpu_relax();
+            }
+
+            shared.stats.block(side, [&]() {
+                return wmp::detail::wait_on_address(shared.state, current, until);
+            });
+        }
+
+#if defined(WMP_COLLECT_STATS)
+        // stats_of() - a snapshot of the channel's runtime statistics
+        template <typename T>
+        auto stats_of(inner<T> const& shared) -> wmp::channel_stats
+        {
+            auto const current = shared.state.load(std::memory_order_acquire);
+            return shared.stats.snapshot((current & VALUE) ? 1 : 0);
+        }
+#endif
+
+        // notify_waiters() - signal threads in wmp::select() and coroutines in async_recv()
+        template <typename T>
+        auto notify_waiters(inner<T>& shared) -> void
+        {
+            // pairs with the fence in wmp::select(); either we observe the
+            // registered waiter or the selector observes the new state
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            shared.waiters.notify();
+        }
     }
 
     // ------------------------------------------------------------------------
@@ -113,115 +179,161 @@ namespace wmp::oneshot
         sender(sender const&)            = delete;
         sender& operator=(sender const&) = delete;
 
-        // default-movable
-        sender(sender&&)            = default;
-        sender& operator=(sender&&) = default;
+        sender(sender&&) = default;
 
-        // send_async() - send value to receiver without waiting for completion
-        //
-        // send_async() simply emplaces the given value in the channel
-        // and returns immediately, without waiting for the receiver to 
-        // take any action.
-        auto send_async(T value) -> send_result
+        // closes the channel previously held, as the destructor does
+        sender& operator=(sender&& other) noexcept
         {
-            using detail::state;
-            using detail::swap_state;
-            using wmp::detail::scoped_srw;
-            using wmp::detail::srw_acquire;
-
-            auto prev = state::init;
-
+            if (this != &other)
             {
-                auto guard = scoped_srw{&m_inner->lock, srw_acquire::exclusive};
-                if (is_closed(m_inner->state))
+                if (m_inner)
                 {
-                    return send_result::failure;
+                    close();
                 }
 
-                m_inner->value = value;
-                prev = swap_state(m_inner->state, state::sent);
+                m_inner = std::move(other.m_inner);
             }
+            return *this;
+        }
 
-            if (state::wait_recv == prev)
-            {
-                ::WakeConditionVariable(&m_inner->rx_cv);
-            }
+        // send_async() - send value to receiver without waiting for completion
+        //
+        // send_async() simply emplaces the given value in the channel
+        // and returns immediately, without waiting for the receiver to
+        // take any action.
+        auto send_async(T value) -> send_result
+        {
+            return emplace_async(std::move(value));
+        }
 
-            return send_result::success;
+        // emplace_async() - construct value in the channel without waiting for completion
+        //
+        // As send_async(), but the value is constructed from `args` directly
+        // in the channel's storage rather than moved into it.
+        template <typename... Args>
+        auto emplace_async(Args&&... args) -> send_result
+        {
+            return publish(std::forward<Args>(args)...)
+                ? send_result::success
+                : send_result::failure;
         }
 
         // send_sync() - send value to receiver, waiting for successful recv() or close
-        // 
+        //
         // The receive operation is considered complete under a number of conditions, including:
         //  - when the receiver receives the sent value
         //  - when the receiver handle goes out of scope, without receiving the value
         //  - when close() is explicitly called on receiver handle, without receiving the value
         auto send_sync(T value) -> send_result
         {
-            using detail::state;
-            using detail::swap_state;
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
+            using namespace detail;
 
-            auto prev = state::init;
+            if (!publish(std::move(value)))
+            {
+                return send_result::failure;
+            }
 
+            auto current = m_inner->state.load(std::memory_order_acquire);
+            for (;;)
             {
-                auto lock = unique_srw{&m_inner->lock, srw_acquire::exclusive};
-                if (is_closed(m_inner->state))
+                if (current & (RECEIVED | RX_CLOSED))
                 {
-                    return send_result::failure;
+                    break;
                 }
-                else if (state::wait_send == m_inner->state)
-                {
-                    // receiver already waiting on send()
-                    m_inner->value = value;
-                    prev = swap_state(m_inner->state, state::sent);
-                }
-                else
+
+                // advertise that we are about to park, then park
+                if (!(current & TX_WAITING))
                 {
-                    // receiver not yet waiting on send()
-                    m_inner->value = value;
-                    swap_state(m_inner->state, state::wait_recv);
-                    while (state::wait_recv == m_inner->state)
+                    if (!m_inner->state.compare_exchange_weak(
+                        current, current | TX_WAITING, std::memory_order_acq_rel))
                     {
-                        ::SleepConditionVariableSRW(&m_inner->tx_cv, &m_inner->lock, INFINITE, 0);
+                        continue;
                     }
-
-                    prev = swap_state(m_inner->state, state::closed);
+                    current |= TX_WAITING;
                 }
+
+                detail::park(*m_inner, current, wmp::detail::blocked_side::sender);
+                current = m_inner->state.load(std::memory_order_acquire);
             }
 
             // when waiting for send() to complete synchonously, the receiver may close the
-            // channel explicitly or drop the receiver handle, so we distinguish between a 
+            // channel explicitly or drop the receiver handle, so we distinguish between a
             // successful synchronous send() and a failed one
-            return state::closed_recv == prev 
-                ? send_result::success 
+            return (current & RECEIVED)
+                ? send_result::success
                 : send_result::failure;
         }
 
+#if defined(WMP_COLLECT_STATS)
+        // stats() - a snapshot of the channel's runtime statistics
+        auto stats() const -> wmp::channel_stats
+        {
+            return detail::stats_of(*m_inner);
+        }
+#endif
+
         // close() - explicitly close the channel
         //
         // Both the sender and the receiver can explicitly close the channel
-        // before or after a value is sent across it.
+        // before or after a value is sent across it; a value sent before
+        // the sender closes remains available to the receiver.
         auto close() -> void
         {
-            using detail::state;
-            using detail::swap_state;
-            using wmp::detail::scoped_srw;
-            using wmp::detail::srw_acquire;
+            using namespace detail;
 
-            auto prev = state::init;
+            auto const prev = m_inner->state.fetch_or(TX_CLOSED, std::memory_order_acq_rel);
+            if ((prev & RX_WAITING) && !(prev & TX_CLOSED))
+            {
+                // notify receiver that channel has been closed
+                detail::wake(*m_inner);
+            }
 
+            if (!(prev & TX_CLOSED))
             {
-                auto guard = scoped_srw{&m_inner->lock, srw_acquire::exclusive};
-                prev = swap_state(m_inner->state, state::closed);
+                detail::notify_waiters(*m_inner);
             }
+        }
 
-            if (state::wait_send == prev)
+    private:
+        // publish() - construct the value and make it visible to the receiver
+        template <typename... Args>
+        auto publish(Args&&... args) -> bool
+        {
+            using namespace detail;
+
+            auto current = m_inner->state.load(std::memory_order_acquire);
+            if (current & (VALUE | RECEIVED | TX_CLOSED | RX_CLOSED))
             {
-                // notify receiver that channel has been closed
-                ::WakeConditionVariable(&m_inner->rx_cv);
+                return false;
             }
+
+            // only the sender ever writes the storage, and only while VALUE is clear
+            ::new (static_cast<void*>(m_inner->storage)) T(std::forward<Args>(args)...);
+
+            while (!m_inner->state.compare_exchange_weak(
+                current, (current | VALUE) & ~RX_WAITING, std::memory_order_acq_rel))
+            {
+                if (current & RX_CLOSED)
+                {
+                    // the receiver closed while the value was being constructed
+                    m_inner->value()->~T();
+                    return false;
+                }
+            }
+
+            m_inner->stats.add_sent(1);
+            m_inner->stats.note_depth(1);
+            wmp::detail::trace_event(
+                wmp::detail::trace_kind::send, wmp::detail::trace_source::oneshot, m_inner.get());
+
+            if (current & RX_WAITING)
+            {
+                // only the receiver parked in recv() needs a wake
+                detail::wake(*m_inner);
+            }
+
+            detail::notify_waiters(*m_inner);
+            return true;
         }
     };
 
@@ -233,9 +345,16 @@ namespace wmp::oneshot
     {
         std::shared_ptr<detail::inner<T>> m_inner;
 
+        // created on the first call to native_handle(); declared after
+        // m_inner so that it is destroyed (and deregistered) first
+        std::unique_ptr<wmp::detail::pollable> m_pollable;
+
     public:
+        using native_handle_type = wmp::detail::native_event::native_handle_type;
+
         receiver(std::shared_ptr<detail::inner<T>> inner)
             : m_inner{inner}
+            , m_pollable{}
         {}
 
         ~receiver()
@@ -251,93 +370,132 @@ namespace wmp::oneshot
         receiver(receiver const&)           = delete;
         receiver operator=(receiver const&) = delete;
 
-        // default-movable
-        receiver(receiver&&)            = default;
-        receiver& operator=(receiver&&) = default;
+        receiver(receiver&&) = default;
 
-        // recv() - blocking receive operation
-        auto recv() -> std::optional<T>
+        // closes the channel previously held, deregistering the native
+        // handle while its waiter list is still alive
+        receiver& operator=(receiver&& other) noexcept
         {
-            using detail::state;
-            using detail::swap_state;
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
-
-            auto value = std::optional<T>{}; // std::nullopt
-            auto prev  = state::init;
-
+            if (this != &other)
             {
-                auto lock = unique_srw{&m_inner->lock, srw_acquire::exclusive};
-                if (is_closed(m_inner->state))
+                m_pollable.reset();
+                if (m_inner)
                 {
-                    return value;
+                    close();
                 }
-                else if (state::sent == m_inner->state ||
-                         state::wait_recv == m_inner->state)
-                {
-                    // value is available, sender possibly waiting
-                    value.swap(m_inner->value);
-                    prev = swap_state(m_inner->state, state::closed_recv);
-                }
-                else
-                {
-                    // value is not yet ready; wait for sender to make progress
-                    swap_state(m_inner->state, state::wait_send);
-                    while (state::wait_recv == m_inner->state)
-                    {
-                        ::SleepConditionVariableSRW(&m_inner->rx_cv, &m_inner->lock, INFINITE, 0);
-                    }
 
-                    value.swap(m_inner->value);
-                    prev = swap_state(m_inner->state, state::closed_recv);
-                }
+                m_inner    = std::move(other.m_inner);
+                m_pollable = std::move(other.m_pollable);
             }
+            return *this;
+        }
 
-            if (state::wait_recv == prev)
-            {
-                // sender waiting on recv(), notify
-                ::WakeConditionVariable(&m_inner->tx_cv);
-            }
+        // recv() - blocking receive operation
+        //
+        // Returns an empty std::optional if the sender closes the channel
+        // without sending, or if the receiver has already closed it.
+        auto recv() -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::never());
+        }
 
-            return value;
+        // recv_timeout() - blocking receive operation with timeout
+        //
+        // As recv(), but also returns an empty std::optional once the timeout expires.
+        template <typename Duration>
+        auto recv_timeout(Duration timeout) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::after(timeout));
+        }
+
+        // recv_until() - blocking receive operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto recv_until(std::chrono::time_point<Clock, Duration> const& deadline) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::at(deadline));
         }
 
         // try_recv() - non-blocking receive operation
         auto try_recv() -> std::optional<T>
         {
-            using detail::state;
-            using detail::swap_state;
-            using wmp::detail::scoped_srw;
-            using wmp::detail::srw_acquire;
+            using namespace detail;
+
+            auto const current = m_inner->state.load(std::memory_order_acquire);
+            if (!(current & VALUE))
+            {
+                rearm();
+                return std::nullopt;
+            }
 
-            auto value = std::optional<T>{}; // std::nullopt
-            auto prev  = state::init;
+            return take(current);
+        }
+
+        // ready() - whether recv() would return without blocking
+        //
+        // The receiver is ready once a value has been sent, or once the
+        // channel has been closed from either side.
+        auto ready() const -> bool
+        {
+            using namespace detail;
+            return 0 != (m_inner->state.load(std::memory_order_acquire) &
+                (VALUE | RECEIVED | TX_CLOSED | RX_CLOSED));
+        }
 
+        // native_handle() - a handle that the platform's wait facilities can wait on
+        //
+        // The handle (an eventfd on Linux, an event object on Windows) is
+        // signaled once the receiver is ready(): once a value has been sent
+        // or the channel has been closed. It is created on first use and
+        // remains owned by the receiver.
+        auto native_handle() -> native_handle_type
+        {
+            if (!m_pollable)
             {
-                auto guard = scoped_srw{&m_inner->lock, srw_acquire::exclusive};
+                m_pollable = std::make_unique<wmp::detail::pollable>(m_inner->waiters);
+
+                // a value sent before the handle existed never signaled it
+                rearm();
+            }
+
+            return m_pollable->native_handle();
+        }
+
+#if WMP_HAS_COROUTINES
+        // async_recv() - receive operation that suspends the calling coroutine
+        //
+        // As recv(), but a coroutine that must wait for the value is
+        // suspended, not parked, and resumed on `executor` once the value
+        // is sent or the channel is closed. The receiver must outlive the task.
+        template <typename Executor>
+        auto async_recv(Executor& executor) -> wmp::detail::task<std::optional<T>>
+        {
+            using namespace detail;
 
-                if (is_closed(m_inner->state))
+            for (;;)
+            {
+                auto const current = m_inner->state.load(std::memory_order_acquire);
+                if (current & VALUE)
                 {
-                    return value;
+                    co_return take(current);
                 }
-                
-                if (state::sent == m_inner->state || 
-                    state::wait_recv == m_inner->state)
+                else if (current & (TX_CLOSED | RX_CLOSED | RECEIVED))
                 {
-                    // value is available, sender possibly waiting on recv completion
-                    value.swap(m_inner->value);
-                    prev = swap_state(m_inner->state, state::closed_recv);
+                    co_return std::nullopt;
                 }
-            }
 
-            if (state::wait_recv == prev)
-            {
-                // sender waiting on recv(), notify
-                ::WakeConditionVariable(&m_inner->tx_cv);
+                co_await wmp::detail::readiness{
+                    m_inner->waiters, executor, [this]() { return ready(); }};
             }
+        }
+#endif
 
-            return value;
+#if defined(WMP_COLLECT_STATS)
+        // stats() - a snapshot of the channel's runtime statistics
+        auto stats() const -> wmp::channel_stats
+        {
+            return detail::stats_of(*m_inner);
         }
+#endif
 
         // close() - explicitly close the channel
         //
@@ -348,23 +506,132 @@ namespace wmp::oneshot
         // after a call to close() to check for the presence of a sent value.
         auto close() -> void
         {
-            using detail::state;
-            using detail::swap_state;
-            using wmp::detail::scoped_srw;
-            using wmp::detail::srw_acquire;
+            using namespace detail;
 
-            auto prev = state::init;
+            auto const prev = m_inner->state.fetch_or(RX_CLOSED, std::memory_order_acq_rel);
+            if ((prev & TX_WAITING) && !(prev & RX_CLOSED))
+            {
+                // notify sender that channel has been closed
+                detail::wake(*m_inner);
+            }
+        }
+
+    private:
+        friend struct wmp::detail::select_access;
+
+        auto select_waiters() -> wmp::detail::waiter_list&
+        {
+            return m_inner->waiters;
+        }
 
+        // rearm() - clear the native handle's signal while the receiver is not ready
+        auto rearm() -> void
+        {
+            if (m_pollable)
             {
-                auto guard = scoped_srw{&m_inner->lock, srw_acquire::exclusive};
-                prev = swap_state(m_inner->state, state::closed);
+                m_pollable->rearm([this]() { return ready(); });
             }
+        }
+
+        auto recv_by(wmp::detail::deadline const until) -> std::optional<T>
+        {
+            using namespace detail;
 
-            if (state::wait_recv == prev)
+            auto current = m_inner->state.load(std::memory_order_acquire);
+            for (;;)
             {
-                // notify sender that channel has been closed
-                ::WakeConditionVariable(&m_inner->tx_cv);
+                if (current & VALUE)
+                {
+                    return take(current);
+                }
+                else if (current & (TX_CLOSED | RX_CLOSED | RECEIVED))
+                {
+                    return std::nullopt;
+                }
+                else if (until.expired())
+                {
+                    // RX_WAITING may remain set; the sender's next transition clears it
+                    return std::nullopt;
+                }
+
+                // advertise that we are about to park, then park
+                if (!(current & RX_WAITING))
+                {
+                    if (!m_inner->state.compare_exchange_weak(
+                        current, current | RX_WAITING, std::memory_order_acq_rel))
+                    {
+                        continue;
+                    }
+                    current |= RX_WAITING;
+                }
+
+                detail::park(*m_inner, current, wmp::detail::blocked_side::receiver, until);
+                current = m_inner->state.load(std::memory_order_acquire);
+            }
+        }
+
+        // take() - move the sent value out of the channel; VALUE must be set in `current`
+        auto take(detail::state current) -> std::optional<T>
+        {
+            using namespace detail;
+
+            // only the receiver ever clears VALUE, so this CAS only fails on
+            // a concurrent change to flags owned by the sender
+            auto const updated = [](state s) {
+                return (s & ~(VALUE | TX_WAITING)) | RECEIVED | RX_CLOSED;
+            };
+            while (!m_inner->state.compare_exchange_weak(
+                current, updated(current), std::memory_order_acq_rel)) {}
+
+            auto value = std::optional<T>{std::move(*m_inner->value())};
+            m_inner->value()->~T();
+            m_inner->stats.add_received(1);
+            wmp::detail::trace_event(
+                wmp::detail::trace_kind::recv, wmp::detail::trace_source::oneshot, m_inner.get());
+
+            if (current & TX_WAITING)
+            {
+                // sender waiting on recv(), notify
+                detail::wake(*m_inner);
             }
+
+            return value;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // pool
+
+    // pool - a recycling allocator for the shared state of oneshot channels
+    //
+    // Channels created with create(pool&) draw their shared state (along
+    // with its reference counts) from the pool, and return it to the pool
+    // once both the sender and the receiver have been dropped; each thread
+    // recycles state through its own free list. The pool must outlive
+    // every channel created from it.
+    template <typename T>
+    class pool
+    {
+        wmp::detail::slab_pool m_slab;
+
+        template <typename U>
+        friend auto create(pool<U>& p) -> std::pair<sender<U>, receiver<U>>;
+
+    public:
+        pool() = default;
+
+        // non-copyable
+        pool(pool const&)            = delete;
+        pool& operator=(pool const&) = delete;
+
+        // non-movable
+        pool(pool&&)            = delete;
+        pool& operator=(pool&&) = delete;
+
+        // available() - the number of released channel states held for reuse
+        auto available() -> std::size_t
+        {
+            return m_slab.available();
         }
     };
 
@@ -378,9 +645,18 @@ namespace wmp::oneshot
     // and receiver objects that wrap the state and enable interaction
     // with the channel itself.
     template <typename T>
-    auto create() -> std::pair<sender<T>, receiver<T>> 
+    auto create() -> std::pair<sender<T>, receiver<T>>
     {
         auto shared_inner = std::make_shared<detail::inner<T>>();
         return std::pair{ sender<T>{shared_inner}, receiver<T>{shared_inner} };
     }
-}
\ No newline at end of file
+
+    // create() - construct a new oneshot channel whose shared state is drawn from `p`
+    template <typename T>
+    auto create(pool<T>& p) -> std::pair<sender<T>, receiver<T>>
+    {
+        using allocator = wmp::detail::slab_allocator<detail::inner<T>>;
+        auto shared_inner = std::allocate_shared<detail::inner<T>>(allocator{&p.m_slab});
+        return std::pair{ sender<T>{shared_inner}, receiver<T>{shared_inner} };
+    }
+}
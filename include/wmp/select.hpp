@@ -0,0 +1,150 @@
+// select.hpp
+//
+// Wait on several receivers at once.
+//
+// select() accepts any mix of mpsc, oneshot and watch receivers. The calling
+// thread registers a single waiter with each channel and parks on it; the
+// first channel to become ready wakes it. Nothing is received: select()
+// reports which receiver is ready, and the caller then receives from it.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include "detail/backend.hpp"
+#include "detail/waiter.hpp"
+
+namespace wmp
+{
+    // ------------------------------------------------------------------------
+    // detail
+
+    namespace detail
+    {
+        struct select_access
+        {
+            template <typename Receiver>
+            static auto waiters(Receiver& receiver) -> waiter_list&
+            {
+                return receiver.select_waiters();
+            }
+        };
+
+        // select_registration - a waiter's registration with a single channel
+        class select_registration
+        {
+            waiter_list& m_list;
+            waiter&      m_waiter;
+
+        public:
+            select_registration(waiter_list& list, waiter& w)
+                : m_list{list}
+                , m_waiter{w}
+            {
+                m_list.add(&m_waiter);
+            }
+
+            ~select_registration()
+            {
+                m_list.remove(&m_waiter);
+            }
+
+            // non-copyable
+            select_registration(select_registration const&)            = delete;
+            select_registration& operator=(select_registration const&) = delete;
+
+            // non-movable
+            select_registration(select_registration&&)            = delete;
+            select_registration& operator=(select_registration&&) = delete;
+        };
+
+        // first_ready() - the index of the first ready receiver, if any
+        template <typename... Receivers>
+        auto first_ready(Receivers&... receivers) -> std::optional<std::size_t>
+        {
+            auto index = std::size_t{0};
+            auto found = false;
+
+            // stops evaluating ready() at the first receiver that reports it
+            ((found = found || receivers.ready(), found ? void() : void(++index)), ...);
+
+            return found ? std::optional<std::size_t>{index} : std::nullopt;
+        }
+
+        template <typename... Receivers>
+        auto select_by(
+            wmp::detail::deadline const until,
+            Receivers&...               receivers) -> std::optional<std::size_t>
+        {
+            if (auto const index = first_ready(receivers...))
+            {
+                return index;
+            }
+
+            auto w = thread_waiter{};
+            select_registration registrations[] = {
+                select_registration{select_access::waiters(receivers), w}... };
+            (void)registrations;
+
+            for (;;)
+            {
+                w.reset();
+
+                // pairs with the fence each channel issues before it notifies
+                // its waiters; either the channel observes our registration
+                // or we observe the channel's new state
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (auto const index = first_ready(receivers...))
+                {
+                    return index;
+                }
+
+                if (!w.wait(until))
+                {
+                    return first_ready(receivers...);
+                }
+            }
+        }
+
+    }
+
+    // ------------------------------------------------------------------------
+    // select()
+
+    // select() - block until any of the given receivers is ready
+    //
+    // Returns the index (in argument order) of a ready receiver; when several
+    // are ready at once, the lowest index wins. A receiver is ready when its
+    // recv() would return without blocking: an mpsc receiver holds a value,
+    // a oneshot receiver has a value or has been closed, and a watch receiver
+    // has an unseen update or has lost its sender.
+    template <typename... Receivers>
+    auto select(Receivers&... receivers) -> std::size_t
+    {
+        static_assert(sizeof...(Receivers) > 0, "select() requires at least one receiver");
+        return *detail::select_by(wmp::detail::deadline::never(), receivers...);
+    }
+
+    // select_timeout() - block until any of the given receivers is ready, or the timeout expires
+    //
+    // Returns an empty std::optional if no receiver became ready in time.
+    template <typename Duration, typename... Receivers>
+    auto select_timeout(Duration timeout, Receivers&... receivers) -> std::optional<std::size_t>
+    {
+        static_assert(sizeof...(Receivers) > 0, "select_timeout() requires at least one receiver");
+        return detail::select_by(wmp::detail::deadline::after(timeout), receivers...);
+    }
+
+    // select_until() - block until any of the given receivers is ready, or until `deadline`
+    template <typename Clock, typename Duration, typename... Receivers>
+    auto select_until(
+        std::chrono::time_point<Clock, Duration> const& deadline,
+        Receivers&...                                   receivers) -> std::optional<std::size_t>
+    {
+        static_assert(sizeof...(Receivers) > 0, "select_until() requires at least one receiver");
+        return detail::select_by(wmp::detail::deadline::at(deadline), receivers...);
+    }
+}
@@ -0,0 +1,389 @@
+// spsc.hpp
+//
+// A bounded, single-producer, single-consumer channel.
+//
+// The API mirrors wmp::mpsc, minus sender::clone(): the sender is neither
+// copyable nor clonable, so the single-producer contract of the underlying
+// ring is enforced by the type system rather than by synchronization.
+//
+// The ring itself never executes an atomic read-modify-write. Every send
+// and receive does, however, issue one sequentially consistent fence in
+// notify() before checking whether the peer is parked; that fence is a full
+// barrier (mfence or a locked instruction on x86) and is the dominant cost
+// of an uncontended operation. It cannot be dropped from the fast path: a
+// one-sided fence would let the peer park after missing our progress.
+
+#pragma once
+
+#include <tuple>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <optional>
+
+#include "detail/spin.hpp"
+#include "detail/trace.hpp"
+#include "detail/backend.hpp"
+#include "detail/cache_line.hpp"
+#include "detail/spsc_ring.hpp"
+
+namespace wmp::spsc
+{
+    // ------------------------------------------------------------------------
+    // detail::inner
+
+    namespace detail
+    {
+        template <typename T>
+        struct inner
+        {
+            wmp::detail::spsc_ring<T> buffer;
+
+            // nonzero while the sender (receiver) is parked and not yet
+            // notified; each side parks directly on its own word
+            alignas(wmp::detail::CACHE_LINE_SIZE) std::atomic<uint32_t> sender_waiting;
+            alignas(wmp::detail::CACHE_LINE_SIZE) std::atomic<uint32_t> receiver_waiting;
+
+            explicit inner(std::size_t const capacity)
+                : buffer{capacity}
+                , sender_waiting{0}
+                , receiver_waiting{0} {}
+        };
+
+        // trace_event() - record a send or receive of `count` values
+        template <typename T>
+        auto trace_event(
+            inner<T> const&               shared,
+            wmp::detail::trace_kind const kind,
+            std::size_t const             count = 1) -> void
+        {
+            wmp::detail::trace_event(kind, wmp::detail::trace_source::spsc, &shared, count);
+        }
+
+        // notify() - wake the peer parked on `waiting`, if it is parked
+        inline auto notify(std::atomic<uint32_t>& waiting) -> void
+        {
+            // pairs with the fence in await(); either we observe the peer's
+            // flag or the peer observes our progress on the ring. Paid on
+            // every send and receive, whether or not the peer is parked
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0 &&
+                waiting.exchange(0, std::memory_order_relaxed) != 0)
+            {
+                wmp::detail::wake_address_one(waiting);
+            }
+        }
+
+        // await() - invoke `attempt` until it reports success or the deadline passes
+        //
+        // Spins briefly, then parks on `waiting` between attempts. Returns
+        // the result of the final attempt.
+        template <typename Attempt>
+        auto await(
+            std::atomic<uint32_t>&      waiting,
+            Attempt&&                   attempt,
+            wmp::detail::deadline const until) -> bool
+        {
+            for (auto spins = 0u; spins < wmp::detail::SPIN_LIMIT; ++spins)
+            {
+                if (attempt())
+                {
+                    return true;
+                }
+                wmp::detail::cpu_relax();
+            }
+
+            auto done = false;
+            for (;;)
+            {
+                waiting.store(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if ((done = attempt()))
+                {
+                    break;
+                }
+
+                if (!wmp::detail::wait_on_address(waiting, 1, until))
+                {
+                    done = attempt();
+                    break;
+                }
+            }
+
+            waiting.store(0, std::memory_order_relaxed);
+            return done;
+        }
+
+    }
+
+    // ------------------------------------------------------------------------
+    // sender
+
+    enum class send_result
+    {
+        success,
+        failure,
+        timeout
+    };
+
+    template <typename T>
+    class sender
+    {
+        std::shared_ptr<detail::inner<T>> m_inner;
+
+    public:
+        sender(std::shared_ptr<detail::inner<T>> inner)
+            : m_inner{inner}
+        {}
+
+        // non-copyable and non-clonable; there is only ever one producer
+        sender(sender const&)            = delete;
+        sender& operator=(sender const&) = delete;
+
+        // default movable
+        sender(sender&&)            = default;
+        sender& operator=(sender&&) = default;
+
+        // send() - blocking send operation (indefinite timeout)
+        auto send(T value) -> send_result
+        {
+            return emplace_by(wmp::detail::deadline::never(), std::move(value));
+        }
+
+        // send_timeout() - blocking send operation with timeout
+        template <typename Duration>
+        auto send_timeout(T value, Duration timeout) -> send_result
+        {
+            return emplace_by(wmp::detail::deadline::after(timeout), std::move(value));
+        }
+
+        // send_until() - blocking send operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto send_until(T value, std::chrono::time_point<Clock, Duration> const& deadline) -> send_result
+        {
+            return emplace_by(wmp::detail::deadline::at(deadline), std::move(value));
+        }
+
+        // try_send() - non-blocking send operation
+        auto try_send(T value) -> send_result
+        {
+            return try_emplace_send(std::move(value));
+        }
+
+        // emplace_send() - blocking send of a value constructed in place
+        template <typename... Args>
+        auto emplace_send(Args&&... args) -> send_result
+        {
+            return emplace_by(wmp::detail::deadline::never(), std::forward<Args>(args)...);
+        }
+
+        // try_emplace_send() - non-blocking send of a value constructed in place
+        template <typename... Args>
+        auto try_emplace_send(Args&&... args) -> send_result
+        {
+            if (m_inner->buffer.try_emplace(std::forward<Args>(args)...))
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::send);
+                detail::notify(m_inner->receiver_waiting);
+                return send_result::success;
+            }
+
+            return send_result::failure;
+        }
+
+        // send_many() - blocking send of every value in [first, last)
+        //
+        // Values are copied from `*first`; pass move iterators to move them.
+        template <typename ForwardIt>
+        auto send_many(ForwardIt first, ForwardIt last) -> send_result
+        {
+            detail::await(
+                m_inner->sender_waiting,
+                [&]() {
+                    auto const next = m_inner->buffer.try_push_many(first, last);
+                    if (next != first)
+                    {
+                        // publish partial progress before (possibly) parking
+                        detail::trace_event(*m_inner, wmp::detail::trace_kind::send, static_cast<std::size_t>(std::distance(first, next)));
+                        first = next;
+                        detail::notify(m_inner->receiver_waiting);
+                    }
+                    return first == last;
+                },
+                wmp::detail::deadline::never());
+
+            return send_result::success;
+        }
+
+        // try_send_many() - non-blocking send of a prefix of [first, last)
+        template <typename ForwardIt>
+        auto try_send_many(ForwardIt first, ForwardIt last) -> std::size_t
+        {
+            auto const next = m_inner->buffer.try_push_many(first, last);
+            auto const sent = static_cast<std::size_t>(std::distance(first, next));
+            if (sent > 0)
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::send, sent);
+                detail::notify(m_inner->receiver_waiting);
+            }
+
+            return sent;
+        }
+
+    private:
+        template <typename... Args>
+        auto emplace_by(wmp::detail::deadline const until, Args&&... args) -> send_result
+        {
+            auto const sent = detail::await(
+                m_inner->sender_waiting,
+                [&]() { return m_inner->buffer.try_emplace(std::forward<Args>(args)...); },
+                until);
+
+            if (!sent)
+            {
+                return send_result::timeout;
+            }
+
+            detail::trace_event(*m_inner, wmp::detail::trace_kind::send);
+            detail::notify(m_inner->receiver_waiting);
+            return send_result::success;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // receiver
+
+    template <typename T>
+    class receiver
+    {
+        std::shared_ptr<detail::inner<T>> m_inner;
+
+    public:
+        receiver(std::shared_ptr<detail::inner<T>> inner)
+            : m_inner{inner}
+        {}
+
+        // non-copyable
+        receiver(receiver const&)            = delete;
+        receiver& operator=(receiver const&) = delete;
+
+        // default movable
+        receiver(receiver&&)            = default;
+        receiver& operator=(receiver&&) = default;
+
+        // recv() - blocking receive operation (indefinite timeout)
+        auto recv() -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::never());
+        }
+
+        // recv_timeout() - blocking receive operation with timeout
+        template <typename Duration>
+        auto recv_timeout(Duration timeout) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::after(timeout));
+        }
+
+        // recv_until() - blocking receive operation with an absolute deadline
+        template <typename Clock, typename Duration>
+        auto recv_until(std::chrono::time_point<Clock, Duration> const& deadline) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::at(deadline));
+        }
+
+        // try_recv() - non-blocking receive operation
+        auto try_recv() -> std::optional<T>
+        {
+            auto value = m_inner->buffer.try_pop();
+            if (value.has_value())
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::recv);
+                detail::notify(m_inner->sender_waiting);
+            }
+
+            return value;
+        }
+
+        // recv_many() - blocking receive of up to `max` values
+        //
+        // Blocks until at least one value is available, then moves every
+        // available value (up to `max`) through `out` and returns the count.
+        template <typename OutputIt>
+        auto recv_many(OutputIt out, std::size_t const max) -> std::size_t
+        {
+            if (0 == max)
+            {
+                return 0;
+            }
+
+            auto count = std::size_t{0};
+
+            detail::await(
+                m_inner->receiver_waiting,
+                [&]() { return (count = m_inner->buffer.try_pop_many(out, max)) > 0; },
+                wmp::detail::deadline::never());
+
+            detail::trace_event(*m_inner, wmp::detail::trace_kind::recv, count);
+            detail::notify(m_inner->sender_waiting);
+            return count;
+        }
+
+        // try_recv_many() - non-blocking receive of up to `max` values
+        template <typename OutputIt>
+        auto try_recv_many(OutputIt out, std::size_t const max) -> std::size_t
+        {
+            auto const count = m_inner->buffer.try_pop_many(out, max);
+            if (count > 0)
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::recv, count);
+                detail::notify(m_inner->sender_waiting);
+            }
+
+            return count;
+        }
+
+        // drain() - non-blocking receive of every value currently in the channel
+        template <typename OutputIt>
+        auto drain(OutputIt out) -> std::size_t
+        {
+            return try_recv_many(out, std::numeric_limits<std::size_t>::max());
+        }
+
+    private:
+        auto recv_by(wmp::detail::deadline const until) -> std::optional<T>
+        {
+            auto value = std::optional<T>{};  // std::nullopt
+
+            auto const received = detail::await(
+                m_inner->receiver_waiting,
+                [&]() { return (value = m_inner->buffer.try_pop()).has_value(); },
+                until);
+
+            if (received)
+            {
+                detail::trace_event(*m_inner, wmp::detail::trace_kind::recv);
+                detail::notify(m_inner->sender_waiting);
+            }
+
+            return value;
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // create()
+
+    // create() - construct a new spsc channel
+    //
+    // The requested capacity is rounded up to the next power of two.
+    template <typename T>
+    auto create(std::size_t const capacity) -> std::pair<sender<T>, receiver<T>>
+    {
+        auto shared_inner = std::make_shared<detail::inner<T>>(capacity);
+        return std::pair{ sender<T>{shared_inner}, receiver<T>{shared_inner} };
+    }
+}
@@ -0,0 +1,128 @@
+// trace.hpp
+//
+// Export of the events recorded when WMP_TRACE is defined (detail/trace.hpp)
+// in the Chrome trace event format, which chrome://tracing and Perfetto
+// (ui.perfetto.dev) both open directly.
+
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "detail/trace.hpp"
+
+namespace wmp::trace
+{
+    namespace detail
+    {
+        inline auto kind_name(wmp::detail::trace_kind const kind) -> char const*
+        {
+            using wmp::detail::trace_kind;
+            switch (kind)
+            {
+            case trace_kind::send:  return "send";
+            case trace_kind::recv:  return "recv";
+            case trace_kind::block: return "block";
+            case trace_kind::wake:  return "wake";
+            }
+            return "unknown";
+        }
+
+        inline auto source_name(wmp::detail::trace_source const source) -> char const*
+        {
+            using wmp::detail::trace_source;
+            switch (source)
+            {
+            case trace_source::backend: return "backend";
+            case trace_source::mpsc:    return "mpsc";
+            case trace_source::oneshot: return "oneshot";
+            case trace_source::watch:   return "watch";
+            case trace_source::spsc:    return "spsc";
+            case trace_source::mpmc:    return "mpmc";
+            case trace_source::bus:     return "bus";
+            }
+            return "unknown";
+        }
+    }
+
+    // write_chrome_json() - write every event still held by any thread's ring
+    //
+    // Sends, receives and wakes are written as instant events, and blocks as
+    // complete events spanning the time the thread was parked; each thread
+    // that recorded events is a track of its own. Timestamps are measured
+    // from the first event recorded in the process. Recording may continue
+    // while the events are written. Without WMP_TRACE, writes an empty trace.
+    inline auto write_chrome_json(std::ostream& out) -> void
+    {
+        out << "{\"traceEvents\":[";
+
+#if defined(WMP_TRACE)
+        using namespace std::chrono;
+        using wmp::detail::trace_kind;
+
+        auto& registry = wmp::detail::trace_registry_instance();
+
+        // calibrate the timestamp counter against the steady clock over the
+        // lifetime of the registry, and at least a few milliseconds
+        auto elapsed = steady_clock::now() - registry.epoch();
+        if (elapsed < 10ms)
+        {
+            std::this_thread::sleep_for(10ms - elapsed);
+        }
+        auto const now_tsc = wmp::detail::trace_clock();
+        elapsed = steady_clock::now() - registry.epoch();
+        auto const ticks_per_us =
+            static_cast<double>(now_tsc - registry.epoch_tsc()) /
+            duration_cast<duration<double, std::micro>>(elapsed).count();
+
+        auto const to_us = [&](uint64_t const ticks) {
+            return static_cast<double>(ticks) / ticks_per_us;
+        };
+
+        auto first   = true;
+        auto records = std::vector<wmp::detail::trace_record>{};
+        for (auto const& ring : registry.rings())
+        {
+            auto const tid = ring->thread();
+
+            out << (first ? "" : ",")
+                << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+                << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+            first = false;
+
+            records.clear();
+            ring->snapshot(records);
+            for (auto const& r : records)
+            {
+                // events recorded before the registry took its epoch
+                auto const tsc = r.tsc > registry.epoch_tsc() ? r.tsc - registry.epoch_tsc() : 0;
+
+                out << ",\n{\"name\":\"" << detail::kind_name(r.kind)
+                    << "\",\"cat\":\"" << detail::source_name(r.source)
+                    << "\",\"pid\":1,\"tid\":" << tid
+                    << ",\"ts\":" << to_us(tsc);
+
+                if (trace_kind::block == r.kind)
+                {
+                    out << ",\"ph\":\"X\",\"dur\":" << to_us(r.arg)
+                        << ",\"args\":{\"object\":\"" << r.object << "\"}}";
+                }
+                else
+                {
+                    out << ",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"object\":\"" << r.object << "\"";
+                    if (trace_kind::wake != r.kind)
+                    {
+                        out << ",\"count\":" << r.arg;
+                    }
+                    out << "}}";
+                }
+            }
+        }
+#endif
+
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+}
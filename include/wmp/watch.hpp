@@ -2,13 +2,23 @@
 
 #pragma once
 
-#include <windows.h>
-
 #include <memory>
+#include <chrono>
 #include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <utility>
+#include <type_traits>
 #include <optional>
 
+#include <wmp/detail/spin.hpp>
+#include <wmp/detail/event.hpp>
+#include <wmp/detail/stats.hpp>
+#include <wmp/detail/trace.hpp>
+#include <wmp/detail/coro.hpp>
+#include <wmp/detail/backend.hpp>
+#include <wmp/detail/waiter.hpp>
+#include <wmp/detail/pollable.hpp>
 #include <wmp/detail/scoped_srw.hpp>
 #include <wmp/detail/unique_srw.hpp>
 
@@ -24,6 +34,103 @@ namespace wmp::watch
         constexpr static uint64_t const VERSION_1 = 2;
     }
 
+    // ------------------------------------------------------------------------
+    // storage
+
+    namespace detail
+    {
+        // values that are trivially copyable (and default constructible, so
+        // a snapshot has somewhere to land) are published through a seqlock
+        template <typename T>
+        constexpr static bool const is_seqlocked_v =
+            std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>;
+
+        // storage - the published value, guarded by inner::object_lock
+        template <typename T, bool = is_seqlocked_v<T>>
+        struct storage
+        {
+            T object;
+
+            explicit storage(T init)
+                : object{std::move(init)} {}
+        };
+
+        // storage - the published value, guarded by a sequence lock
+        //
+        // The single sender bumps `seq` to an odd value, writes the value as
+        // a sequence of relaxed atomic words, and bumps `seq` to the next even
+        // value; readers retry until they observe the same even `seq` on both
+        // sides of their copy. Readers never write shared memory and the
+        // sender never waits for them.
+        template <typename T>
+        struct storage<T, true>
+        {
+            constexpr static std::size_t const WORDS =
+                (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+            // even when stable; advanced by 2 for every write
+            std::atomic<uint64_t> seq;
+            std::atomic<uint64_t> words[WORDS];
+
+            explicit storage(T const init)
+                : seq{0}
+            {
+                uint64_t buffer[WORDS] = {};
+                std::memcpy(buffer, &init, sizeof(T));
+                for (auto i = std::size_t{0}; i < WORDS; ++i)
+                {
+                    words[i].store(buffer[i], std::memory_order_relaxed);
+                }
+            }
+
+            // write() - publish a new value; must only be called by the sender
+            auto write(T const& value) noexcept -> void
+            {
+                uint64_t buffer[WORDS] = {};
+                std::memcpy(buffer, &value, sizeof(T));
+
+                auto const s = seq.load(std::memory_order_relaxed);
+                seq.store(s + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                for (auto i = std::size_t{0}; i < WORDS; ++i)
+                {
+                    words[i].store(buffer[i], std::memory_order_relaxed);
+                }
+
+                seq.store(s + 2, std::memory_order_release);
+            }
+
+            // read() - copy out a consistent snapshot, returning the sequence it was taken at
+            auto read(T& out) const noexcept -> uint64_t
+            {
+                uint64_t buffer[WORDS];
+                for (;;)
+                {
+                    auto const before = seq.load(std::memory_order_acquire);
+                    if (before & 1)
+                    {
+                        // a write is in progress
+                        wmp::detail::cpu_relax();
+                        continue;
+                    }
+
+                    for (auto i = std::size_t{0}; i < WORDS; ++i)
+                    {
+                        buffer[i] = words[i].load(std::memory_order_relaxed);
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (seq.load(std::memory_order_relaxed) == before)
+                    {
+                        std::memcpy(&out, buffer, sizeof(T));
+                        return before;
+                    }
+                }
+            }
+        };
+    }
+
     // ------------------------------------------------------------------------
     // inner
 
@@ -32,30 +139,49 @@ namespace wmp::watch
         template <typename T>
         struct inner
         {   
-            T object;
+            detail::storage<T> storage;
 
-            // read lock acquired by receiver(s) on receiver::borrow()
-            // write lock acquired by sender on sender::broadcast()
-            SRWLOCK            object_lock;
-            // notified on update to stored object
-            CONDITION_VARIABLE object_cv;
+            // read lock acquired by receiver(s) on receiver::borrow() and recv();
+            // write lock acquired by sender on broadcast(); unused for a
+            // seqlocked value
+            wmp::detail::srw_lock object_lock;
 
             // the latest published version
             std::atomic_uint64_t version;
 
+            // notified after every change to `version`; receivers waiting
+            // for an update park here, not on object_lock, and only take
+            // the lock (if at all) once they have been woken
+            wmp::detail::event version_changed;
+
+            // threads blocked in wmp::select() on a receiver, coroutines
+            // suspended in changed(), and receivers' native handles
+            wmp::detail::waiter_list waiters;
+
+            // runtime statistics; empty unless WMP_COLLECT_STATS is defined.
+            // The channel holds a single value rather than a queue, so it
+            // reports no depth, and its sender never blocks
+            wmp::detail::stats_counters<> stats;
+
             inner(T init)
-                : object{init}
-                , object_lock{}
-                , object_cv{}
+                : storage{std::move(init)}
                 // VERSION_0 reserved for receivers that do not "know" initial state
-                , version{VERSION_1}  
-            {
-                ::InitializeSRWLock(&object_lock);
-                ::InitializeConditionVariable(&object_cv);
-            }
+                , version{VERSION_1}
+                , version_changed{} {}
 
             ~inner() = default;
         };
+
+        // notify_changed() - wake every receiver waiting on a change to `version`
+        template <typename T>
+        auto notify_changed(inner<T>& shared) -> void
+        {
+            shared.version_changed.notify_all();
+
+            // notify_all() has issued the fence that pairs with the one in
+            // wmp::select(), whether or not any receiver was parked
+            shared.waiters.notify();
+        }
     }
 
     // ------------------------------------------------------------------------
@@ -79,13 +205,7 @@ namespace wmp::watch
 
         ~sender()
         {
-            // notify any receiver handles that are waiting on updates
-            // that no future updates will be broadcast
-            if (auto shared = m_shared.lock())
-            {
-                std::atomic_fetch_or(&shared->version, detail::CLOSED);
-                ::WakeAllConditionVariable(&shared->object_cv);
-            }
+            release();
         }
 
         // non-copyable;
@@ -93,14 +213,37 @@ namespace wmp::watch
         sender(sender const&)            = delete;
         sender& operator=(sender const&) = delete;
 
-        // default-movable (rely on move semantics of std::weak_ptr)
-        sender(sender&&)            = default;
-        sender& operator=(sender&&) = default;
+        // movable (rely on move semantics of std::weak_ptr)
+        sender(sender&&) = default;
+
+        // closes the channel previously held, as the destructor does
+        sender& operator=(sender&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_shared = std::move(other.m_shared);
+            }
+            return *this;
+        }
 
         // broadcast() - broadcast an update to all receiver handles
         //
         // TODO: migrate to expected<>
         auto broadcast(T object) -> send_result
+        {
+            return emplace_broadcast(std::move(object));
+        }
+
+        // emplace_broadcast() - broadcast an update constructed from `args`
+        //
+        // The new value is constructed before the write lock is acquired and
+        // then moved into place, so outstanding borrow()s are never exposed
+        // to a partially constructed object and the lock is held only for
+        // the duration of the move. A seqlocked value is written without the
+        // lock at all.
+        template <typename... Args>
+        auto emplace_broadcast(Args&&... args) -> send_result
         {
             using wmp::detail::scoped_srw;
             using wmp::detail::srw_acquire;
@@ -117,23 +260,47 @@ namespace wmp::watch
             // extends the lifetime of the shared state to 
             // (at least) the end of this function body
 
+            auto updated = T(std::forward<Args>(args)...);
+
+            if constexpr (detail::is_seqlocked_v<T>)
+            {
+                shared->storage.write(updated);
+
+                // increment the version number;
+                // increment by 2 ensures that CLOSED bit never set
+                std::atomic_fetch_add(&shared->version, 2);
+            }
+            else
             {
                 // acquire right access to the object;
                 // all outstanding borrow()s block write at this point 
-                auto guard = scoped_srw{&m_shared->object_lock, srw_acquire::exclusive};
-                m_shared->object = object;
+                auto guard = scoped_srw{&shared->object_lock, srw_acquire::exclusive};
+                shared->storage.object = std::move(updated);
+                std::atomic_fetch_add(&shared->version, 2);
             }
 
-            // increment the version number;
-            // increment by 2 ensures that CLOSED bit never set
-            std::atomic_fetch_add(&m_shared->version, 2);
+            shared->stats.add_sent(1);
+            wmp::detail::trace_event(
+                wmp::detail::trace_kind::send, wmp::detail::trace_source::watch, shared.get());
 
             // wake all receivers waiting on an update
-            ::WakeAllConditionVariable(&m_shared->object_cv);
+            detail::notify_changed(*shared);
 
             return send_result::success;
         }
 
+#if defined(WMP_COLLECT_STATS)
+        // stats() - a snapshot of the channel's runtime statistics
+        //
+        // Once every receiver handle has been dropped, the statistics are
+        // gone with the channel and the snapshot is all zeros.
+        auto stats() const -> wmp::channel_stats
+        {
+            auto shared = m_shared.lock();
+            return shared ? shared->stats.snapshot(0) : wmp::channel_stats{};
+        }
+#endif
+
         // closed() - determine if all receiver handles have been dropped
         //
         // NOTE: there is a fundamental difference between the functionality
@@ -145,14 +312,26 @@ namespace wmp::watch
         {
             // we rely on the semantics of std::shared_ptr 
             // to manage the lifetime of the shared state 
-            return static_cast<bool>(m_shared.lock());
+            return m_shared.expired();
+        }
+
+    private:
+        auto release() noexcept -> void
+        {
+            // notify any receiver handles that are waiting on updates
+            // that no future updates will be broadcast
+            if (auto shared = m_shared.lock())
+            {
+                std::atomic_fetch_or(&shared->version, detail::CLOSED);
+                detail::notify_changed(*shared);
+            }
         }
     };
 
     // ------------------------------------------------------------------------
     // borrow
 
-    template <typename T>
+    template <typename T, bool = detail::is_seqlocked_v<T>>
     class borrow
     {
         using unique_srw = wmp::detail::unique_srw;
@@ -185,6 +364,34 @@ namespace wmp::watch
         }
     };
 
+    // borrow of a seqlocked value: a private snapshot, holding no lock
+    template <typename T>
+    class borrow<T, true>
+    {
+        T m_object;
+
+    public:
+        explicit borrow(T const& object)
+            : m_object{object}
+        {}
+
+        ~borrow() = default;
+
+        // non-copyable
+        borrow(borrow const&)            = delete;
+        borrow& operator=(borrow const&) = delete;
+
+        // default-movable
+        borrow(borrow&&)            = default;
+        borrow& operator=(borrow&&) = default;
+
+        // snapshot accessible via operator*
+        T const& operator*() const noexcept
+        {
+            return m_object;
+        }
+    };
+
     // ------------------------------------------------------------------------
     // receiver
 
@@ -198,15 +405,23 @@ namespace wmp::watch
     template <typename T>
     class receiver
     {
-        std::atomic_uint64_t              m_version;
+        // only ever accessed by the thread that owns this handle
+        uint64_t                          m_version;
         std::shared_ptr<detail::inner<T>> m_shared;
 
+        // created on the first call to native_handle(); declared after
+        // m_shared so that it is destroyed (and deregistered) first
+        std::unique_ptr<wmp::detail::pollable> m_pollable;
+
     public:
+        using native_handle_type = wmp::detail::native_event::native_handle_type;
+
         receiver(
             uint64_t const                    version, 
             std::shared_ptr<detail::inner<T>> shared)
             : m_version{version} 
             , m_shared{shared}
+            , m_pollable{}
         {}
 
         ~receiver() = default;
@@ -216,17 +431,26 @@ namespace wmp::watch
         receiver(receiver const&)            = delete;
         receiver& operator=(receiver const&) = delete;
 
-        // default-movable
-        receiver(receiver&&)            = default;
-        receiver& operator=(receiver&&) = default;
+        receiver(receiver&&) = default;
+
+        // deregisters the native handle while its waiter list is still alive
+        receiver& operator=(receiver&& other) noexcept
+        {
+            if (this != &other)
+            {
+                m_pollable.reset();
+                m_version  = other.m_version;
+                m_shared   = std::move(other.m_shared);
+                m_pollable = std::move(other.m_pollable);
+            }
+            return *this;
+        }
 
         // clone() - create a new receiver handle
         auto clone() -> receiver<T>
         {
             // cloned receiver inherits version
-            auto const version 
-                = std::atomic_load_explicit(&m_version, std::memory_order_relaxed);
-            return receiver{version, m_shared};
+            return receiver{m_version, m_shared};
         }
 
         // borrow() - return a reference to the most recently sent value
@@ -235,62 +459,213 @@ namespace wmp::watch
         // that holds a read lock on the internal value managed by the channel;
         // for this reason, outstanding borrows can block updates, so references
         // should only be held for short periods of time to minimize contention.
-        auto borrow() -> borrow<T>
+        //
+        // For a seqlocked (trivially copyable) T the borrow instead holds a
+        // consistent snapshot of the value and never blocks updates.
+        auto borrow() -> watch::borrow<T>
         {
             using wmp::detail::unique_srw;
             using wmp::detail::srw_acquire;
 
-            auto lock = unique_srw{&m_shared->object_lock, srw_acquire::shared};
-            return borrow{m_shared->object, std::move(lock)};
+            if constexpr (detail::is_seqlocked_v<T>)
+            {
+                auto snapshot = T{};
+                m_shared->storage.read(snapshot);
+                return watch::borrow<T>{snapshot};
+            }
+            else
+            {
+                auto lock = unique_srw{&m_shared->object_lock, srw_acquire::shared};
+                return watch::borrow<T>{m_shared->storage.object, std::move(lock)};
+            }
         }
 
         // recv() - attempts to clone the latest value sent via the channel
         //
-        // TODO: need to constrain this to only cases in which T is copyable
-        //       constrain via std::enable_if?
+        // recv() requires a copyable T; channels of move-only values are
+        // observed through borrow(), which is always available.
         // TODO: migrate to expected<>
         auto recv() -> std::optional<T>
         {
-            using wmp::detail::unique_srw;
-            using wmp::detail::srw_acquire;
+            return recv_by(wmp::detail::deadline::never());
+        }
+
+        // recv_timeout() - as recv(), waiting no longer than `timeout` for an update
+        template <typename Duration>
+        auto recv_timeout(Duration timeout) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::after(timeout));
+        }
+
+        // recv_until() - as recv(), waiting for an update no later than `deadline`
+        template <typename Clock, typename Duration>
+        auto recv_until(std::chrono::time_point<Clock, Duration> const& deadline) -> std::optional<T>
+        {
+            return recv_by(wmp::detail::deadline::at(deadline));
+        }
+
+        // ready() - whether recv() would return without blocking
+        //
+        // The receiver is ready once a version newer than the last one it
+        // received has been published, or once the sender has been dropped.
+        auto ready() const -> bool
+        {
+            auto const state = std::atomic_load(&m_shared->version);
+            return (state & ~detail::CLOSED) > m_version ||
+                   detail::CLOSED == (state & detail::CLOSED);
+        }
+
+        // native_handle() - a handle that the platform's wait facilities can wait on
+        //
+        // The handle (an eventfd on Linux, an event object on Windows) is
+        // signaled while the receiver is ready(): while an update it has not
+        // yet received is published, or once the sender has been dropped.
+        // recv() clears the signal. The handle is created on first use, is
+        // owned by this receiver, and is not shared with clones.
+        auto native_handle() -> native_handle_type
+        {
+            if (!m_pollable)
+            {
+                m_pollable = std::make_unique<wmp::detail::pollable>(m_shared->waiters);
+
+                // an update published before the handle existed never signaled it
+                rearm();
+            }
+
+            return m_pollable->native_handle();
+        }
+
+#if defined(WMP_COLLECT_STATS)
+        // stats() - a snapshot of the channel's runtime statistics
+        //
+        // `received` counts the updates delivered by recv() across every
+        // receiver handle; a receiver that falls behind skips versions.
+        auto stats() const -> wmp::channel_stats
+        {
+            return m_shared->stats.snapshot(0);
+        }
+#endif
+
+#if WMP_HAS_COROUTINES
+        // changed() - wait for an update, suspending the calling coroutine
+        //
+        // The returned task completes with `true` once a version newer than
+        // the last one received is published, marking that version as seen
+        // (observe it with borrow()), or with `false` if the sender is
+        // dropped first. A coroutine that must wait is suspended, not parked,
+        // and resumed on `executor`. The receiver must outlive the task.
+        template <typename Executor>
+        auto changed(Executor& executor) -> wmp::detail::task<bool>
+        {
+            for (;;)
+            {
+                auto const state = std::atomic_load(&m_shared->version);
+                if ((state & ~detail::CLOSED) > m_version)
+                {
+                    m_version = state & ~detail::CLOSED;
+                    rearm();
+                    co_return true;
+                }
+                else if (detail::CLOSED == (state & detail::CLOSED))
+                {
+                    co_return false;
+                }
+
+                co_await wmp::detail::readiness{
+                    m_shared->waiters, executor, [this]() { return ready(); }};
+            }
+        }
+#endif
 
-            // load the version present in shared state
-            // represents the latest version published by sender
-            auto const state   = std::atomic_load(&m_shared->version);
-            auto const version = (state & !detail::CLOSED);
+    private:
+        friend struct wmp::detail::select_access;
 
-            // update the local version to the latest version
-            if (version != std::atomic_exchange_explicit(
-                &m_version, 
-                version, 
-                std::memory_order_relaxed))
+        auto select_waiters() -> wmp::detail::waiter_list&
+        {
+            return m_shared->waiters;
+        }
+
+        // rearm() - clear the native handle's signal while the receiver is not ready
+        auto rearm() -> void
+        {
+            if (m_pollable)
             {
-                // local version did not match the latest version; update available
-                // this construction allows the receiver to receive the update even
-                // in the event that the channel is closed at this point;
-                // the next time recv() is called the receiver will "notice" the closure
+                m_pollable->rearm([this]() { return ready(); });
             }
+        }
+
+        // count_received() - account for an update delivered, in statistics and traces
+        auto count_received() -> void
+        {
+            m_shared->stats.add_received(1);
+            wmp::detail::trace_event(
+                wmp::detail::trace_kind::recv, wmp::detail::trace_source::watch, m_shared.get());
+        }
+
+        auto recv_by(wmp::detail::deadline const until) -> std::optional<T>
+        {
+            using wmp::detail::unique_srw;
+            using wmp::detail::srw_acquire;
 
-            if (detail::CLOSED == (state & detail::CLOSED))
+            static_assert(std::is_copy_constructible_v<T>,
+                "watch::receiver::recv() requires a copyable T; use borrow()");
+
+            // wait for an update without holding the lock, so that a
+            // broadcast to many receivers does not serialize their wakeups
+            if (!await_update(until))
             {
-                // the channel was closed by sender (sender handle dropped)
                 return std::nullopt;
             }
 
-            // local version is up to date and channel is not closed; wait for broadcast
-            auto published = std::atomic_load(&m_shared->version);
-            auto lock      = unique_srw{&m_shared->object_lock, srw_acquire::shared};
-            while (std::atomic_load_explicit(&m_version, std::memory_order_relaxed) == published)
+            if constexpr (detail::is_seqlocked_v<T>)
             {
-                ::SleepConditionVariableSRW(&m_shared->object_cv, &m_shared->object_lock, INFINITE, 0);
-                published = std::atomic_load(&m_shared->version);
+                // the snapshot may be newer than the version that woke us;
+                // the version is derived from the snapshot so it is never
+                // delivered twice
+                auto value = T{};
+                m_version  = detail::VERSION_1 + m_shared->storage.read(value);
+                count_received();
+                rearm();
+                return value;
             }
+            else
+            {
+                // the version is re-read under the lock so that it matches the value
+                auto lock  = unique_srw{&m_shared->object_lock, srw_acquire::shared};
+                auto state = std::atomic_load(&m_shared->version);
+
+                // update the local version; an update published before the channel
+                // was closed is still delivered, the closure is noticed on next recv()
+                m_version = state & ~detail::CLOSED;
+                count_received();
+                rearm();
+
+                // return the published value; access is safe because read lock is held
+                return std::make_optional<T>(m_shared->storage.object);
+            }
+        }
 
-            // update the local version
-            std::atomic_store_explicit(&m_version, published, std::memory_order_relaxed);
-
-            // return the published value; access is safe because read lock is held
-            return std::make_optional<T>(m_shared->object);
+        // await_update() - wait for a version newer than the local one
+        //
+        // Parks on the channel's version_changed event rather than the object
+        // lock. Returns `false` if the channel was closed and the final update
+        // has already been observed, or if the deadline passed first.
+        auto await_update(wmp::detail::deadline const until) -> bool
+        {
+            auto state = uint64_t{0};
+
+            m_shared->version_changed.await(
+                [&]() {
+                    state = std::atomic_load(&m_shared->version);
+                    return (state & ~detail::CLOSED) > m_version ||
+                           detail::CLOSED == (state & detail::CLOSED);
+                },
+                until,
+                [this](auto&& wait) {
+                    return m_shared->stats.block(wmp::detail::blocked_side::receiver, wait);
+                });
+
+            return (state & ~detail::CLOSED) > m_version;
         }
     };
 
@@ -300,8 +675,7 @@ namespace wmp::watch
     template <typename T>
     auto create(T init) -> std::pair<sender<T>, receiver<T>>
     {
-        // TODO: move rather than copy? explicit ownership
-        auto shared = std::make_shared<detail::inner<T>>(init);
+        auto shared = std::make_shared<detail::inner<T>>(std::move(init));
         auto weak   = std::weak_ptr{shared};
         return std::pair{
             sender<T>{weak}, 
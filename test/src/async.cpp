@@ -0,0 +1,279 @@
+// async.cpp
+//
+// Unit tests for the coroutine awaitables of wmp channels
+
+#include <catch2/catch.hpp>
+
+#include <wmp/mpsc.hpp>
+#include <wmp/watch.hpp>
+#include <wmp/oneshot.hpp>
+
+#if WMP_HAS_COROUTINES
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <coroutine>
+
+using namespace wmp;
+
+namespace
+{
+    // queue_executor - resumes scheduled coroutines when the test drains it
+    class queue_executor
+    {
+        std::mutex                          m_lock;
+        std::deque<std::coroutine_handle<>> m_ready;
+
+    public:
+        auto execute(std::coroutine_handle<> handle) -> void
+        {
+            auto guard = std::lock_guard{m_lock};
+            m_ready.push_back(handle);
+        }
+
+        // run() - resume every scheduled coroutine; returns how many were resumed
+        auto run() -> std::size_t
+        {
+            auto count = std::size_t{0};
+            for (;;)
+            {
+                auto handle = std::coroutine_handle<>{};
+                {
+                    auto guard = std::lock_guard{m_lock};
+                    if (m_ready.empty())
+                    {
+                        return count;
+                    }
+                    handle = m_ready.front();
+                    m_ready.pop_front();
+                }
+                handle.resume();
+                ++count;
+            }
+        }
+    };
+
+    // detached - an eagerly-started coroutine that nobody awaits
+    struct detached
+    {
+        struct promise_type
+        {
+            auto get_return_object() noexcept -> detached { return {}; }
+            auto initial_suspend() noexcept -> std::suspend_never { return {}; }
+            auto final_suspend() noexcept -> std::suspend_never { return {}; }
+            auto return_void() noexcept -> void {}
+            auto unhandled_exception() noexcept -> void { std::terminate(); }
+        };
+    };
+
+    template <typename Receiver, typename Result>
+    auto receive_into(Receiver& rx, queue_executor& executor, Result& result) -> detached
+    {
+        result = co_await rx.async_recv(executor);
+    }
+
+    template <typename Receiver>
+    auto receive_and_count(Receiver& rx, queue_executor& executor, std::atomic<int>& completed) -> detached
+    {
+        co_await rx.async_recv(executor);
+        completed.fetch_add(1);
+    }
+}
+
+TEST_CASE("wmp::mpsc async_recv completes without suspending when a value is available")
+{
+    auto executor = queue_executor{};
+    auto [tx, rx] = mpsc::create<int>(4);
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+
+    auto result = std::optional<int>{};
+    receive_into(rx, executor, result);
+
+    REQUIRE(result == 1);
+    REQUIRE(0 == executor.run());
+}
+
+TEST_CASE("wmp::mpsc async_recv resumes on the executor once a value is sent")
+{
+    auto executor = queue_executor{};
+    auto [tx, rx] = mpsc::create_unbounded<int>();
+
+    auto result = std::optional<int>{};
+    receive_into(rx, executor, result);
+    REQUIRE_FALSE(result.has_value());
+
+    // the send schedules the coroutine but does not run it
+    REQUIRE(mpsc::send_result::success == tx.send(2));
+    REQUIRE_FALSE(result.has_value());
+
+    REQUIRE(1 == executor.run());
+    REQUIRE(result == 2);
+}
+
+TEST_CASE("wmp::mpsc many suspended receivers share a single thread")
+{
+    constexpr static std::size_t const N_CHANNELS = 1000;
+
+    auto executor  = queue_executor{};
+    auto senders   = std::vector<mpsc::sender<int>>{};
+    auto receivers = std::vector<mpsc::receiver<int>>{};
+    for (auto i = std::size_t{0}; i < N_CHANNELS; ++i)
+    {
+        auto [tx, rx] = mpsc::create<int>(1);
+        senders.push_back(std::move(tx));
+        receivers.push_back(std::move(rx));
+    }
+
+    auto results = std::vector<std::optional<int>>(N_CHANNELS);
+    for (auto i = std::size_t{0}; i < N_CHANNELS; ++i)
+    {
+        receive_into(receivers[i], executor, results[i]);
+    }
+
+    auto t = std::thread{[&senders]() {
+        for (auto i = std::size_t{0}; i < senders.size(); ++i)
+        {
+            senders[i].send(static_cast<int>(i));
+        }
+    }};
+    t.join();
+
+    REQUIRE(N_CHANNELS == executor.run());
+    for (auto i = std::size_t{0}; i < N_CHANNELS; ++i)
+    {
+        REQUIRE(results[i] == static_cast<int>(i));
+    }
+}
+
+TEST_CASE("wmp::mpsc a signal racing a suspending receiver never resumes it early")
+{
+    constexpr static auto const N_ROUNDS = 2000;
+
+    // resumed, and so destroyed, on another thread as soon as scheduled
+    auto executor  = queue_executor{};
+    auto stop      = std::atomic<bool>{false};
+    auto completed = std::atomic<int>{0};
+    auto resumer   = std::thread{[&]() {
+        while (!stop.load())
+        {
+            executor.run();
+        }
+    }};
+
+    for (auto i = 0; i < N_ROUNDS; ++i)
+    {
+        auto [tx, rx] = mpsc::create<int>(1);
+        auto t = std::thread{[&tx = tx]() { tx.send(1); }};
+        receive_and_count(rx, executor, completed);
+        t.join();
+
+        while (completed.load() != i + 1)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    stop.store(true);
+    resumer.join();
+    REQUIRE(N_ROUNDS == completed.load());
+}
+
+TEST_CASE("wmp::mpsc async_send suspends on a full buffer until the receiver frees space")
+{
+    auto executor = queue_executor{};
+    auto [tx, rx] = mpsc::create<int>(1);
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+
+    auto result = std::optional<mpsc::send_result>{};
+    [](auto& tx, auto& executor, auto& result) -> detached {
+        result = co_await tx.async_send(2, executor);
+    }(tx, executor, result);
+    REQUIRE_FALSE(result.has_value());
+
+    REQUIRE(rx.try_recv() == 1);
+    REQUIRE(1 == executor.run());
+    REQUIRE(result == mpsc::send_result::success);
+    REQUIRE(rx.try_recv() == 2);
+}
+
+TEST_CASE("wmp::mpsc destroying a suspended task withdraws its registration")
+{
+    auto executor = queue_executor{};
+    auto [tx, rx] = mpsc::create<int>(4);
+
+    {
+        // start the task by hand, leaving it suspended inside the channel
+        auto pending = rx.async_recv(executor);
+        pending.await_suspend(std::noop_coroutine()).resume();
+    }
+
+    // the frame is gone; the send must not schedule it
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+    REQUIRE(0 == executor.run());
+    REQUIRE(rx.try_recv() == 1);
+}
+
+TEST_CASE("wmp::oneshot async_recv resumes on send or close")
+{
+    auto executor = queue_executor{};
+
+    SECTION("send")
+    {
+        auto [tx, rx] = oneshot::create<int>();
+        auto result = std::optional<int>{};
+        receive_into(rx, executor, result);
+
+        REQUIRE(oneshot::send_result::success == tx.send_async(3));
+        REQUIRE(1 == executor.run());
+        REQUIRE(result == 3);
+    }
+
+    SECTION("close")
+    {
+        auto [tx, rx] = oneshot::create<int>();
+        auto result = std::optional<int>{-1};
+        receive_into(rx, executor, result);
+
+        tx.close();
+        REQUIRE(1 == executor.run());
+        REQUIRE_FALSE(result.has_value());
+    }
+}
+
+TEST_CASE("wmp::watch changed() resumes on broadcast and on sender drop")
+{
+    auto executor = queue_executor{};
+    auto [tx, rx] = watch::create<int>(0);
+
+    auto changed = std::optional<bool>{};
+    auto await_change = [](auto& rx, auto& executor, auto& changed) -> detached {
+        changed = co_await rx.changed(executor);
+    };
+
+    // the initial value is unseen, so the first changed() completes at once
+    await_change(rx, executor, changed);
+    REQUIRE(changed == true);
+
+    changed.reset();
+    await_change(rx, executor, changed);
+    REQUIRE_FALSE(changed.has_value());
+
+    REQUIRE(watch::send_result::success == tx.broadcast(1));
+    REQUIRE(1 == executor.run());
+    REQUIRE(changed == true);
+    REQUIRE(1 == *rx.borrow());
+
+    changed.reset();
+    await_change(rx, executor, changed);
+    {
+        auto drop = std::move(tx);
+    }
+    REQUIRE(1 == executor.run());
+    REQUIRE(changed == false);
+}
+
+#endif // WMP_HAS_COROUTINES
@@ -0,0 +1,127 @@
+// backend.cpp
+//
+// Unit tests for the platform synchronization backend.
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include <wmp/detail/backend.hpp>
+#include <wmp/detail/scoped_srw.hpp>
+#include <wmp/detail/unique_srw.hpp>
+
+using namespace wmp::detail;
+
+TEST_CASE("wmp::detail::srw_lock provides mutual exclusion for writers")
+{
+    constexpr static auto const N_THREADS    = 8;
+    constexpr static auto const N_INCREMENTS = 10000;
+
+    auto lock    = srw_lock{};
+    auto counter = 0ul;
+
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < N_THREADS; ++i)
+    {
+        threads.emplace_back([&]() {
+            for (auto j = 0; j < N_INCREMENTS; ++j)
+            {
+                auto guard = scoped_srw{&lock, srw_acquire::exclusive};
+                ++counter;
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    REQUIRE(counter == N_THREADS * N_INCREMENTS);
+}
+
+TEST_CASE("wmp::detail::srw_lock admits multiple concurrent readers")
+{
+    auto lock = srw_lock{};
+
+    auto r1 = unique_srw{&lock, srw_acquire::shared};
+    auto r2 = unique_srw{&lock, srw_acquire::shared};
+    REQUIRE(r1.owns_lock());
+    REQUIRE(r2.owns_lock());
+}
+
+TEST_CASE("wmp::detail::cond_var sleep() wakes on wake_one()")
+{
+    auto lock  = srw_lock{};
+    auto cv    = cond_var{};
+    auto ready = false;
+
+    auto waker = std::thread{[&]() {
+        {
+            auto guard = scoped_srw{&lock, srw_acquire::exclusive};
+            ready = true;
+        }
+        cv.wake_one();
+    }};
+
+    {
+        auto guard = unique_srw{&lock, srw_acquire::exclusive};
+        while (!ready)
+        {
+            cv.sleep(lock, srw_acquire::exclusive);
+        }
+    }
+
+    waker.join();
+    REQUIRE(ready);
+}
+
+TEST_CASE("wmp::detail::cond_var sleep() expires after timeout")
+{
+    using namespace std::chrono;
+
+    auto lock = srw_lock{};
+    auto cv   = cond_var{};
+
+    auto guard = unique_srw{&lock, srw_acquire::exclusive};
+
+    auto const start = steady_clock::now();
+    auto const woken = cv.sleep(lock, srw_acquire::exclusive, deadline::after(50ms));
+    auto const elapsed = steady_clock::now() - start;
+
+    REQUIRE_FALSE(woken);
+    REQUIRE(elapsed >= 40ms);
+}
+
+TEST_CASE("wmp::detail::deadline saturates and expires")
+{
+    using namespace std::chrono;
+
+    REQUIRE(deadline::never().is_never());
+    REQUIRE_FALSE(deadline::never().expired());
+    REQUIRE(deadline::after(hours::max()).is_never());
+
+    REQUIRE(deadline::after(-1s).expired());
+    REQUIRE(deadline::after(0ns).expired());
+    REQUIRE(deadline::at(steady_clock::now() - 1ms).expired());
+
+    auto const later = deadline::after(1h);
+    REQUIRE_FALSE(later.expired());
+    REQUIRE(later.remaining() > 59min);
+}
+
+TEST_CASE("wmp::detail::wait_on_address() honors sub-millisecond deadlines")
+{
+    using namespace std::chrono;
+
+    auto word = std::atomic<uint32_t>{0};
+
+    auto const start   = steady_clock::now();
+    auto const woken   = wait_on_address(word, 0, deadline::after(200us));
+    auto const elapsed = steady_clock::now() - start;
+
+    REQUIRE_FALSE(woken);
+    REQUIRE(elapsed >= 200us);
+}
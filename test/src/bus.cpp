@@ -0,0 +1,287 @@
+// bus.cpp
+//
+// Unit tests for wmp::bus
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <thread>
+#include <numeric>
+
+#include <wmp/bus.hpp>
+
+using namespace wmp;
+
+TEST_CASE("wmp::bus every receiver observes every message")
+{
+    auto [tx, rx1] = bus::create<int>(8);
+    auto rx2 = rx1.clone();
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(bus::send_result::success == tx.try_send(i));
+    }
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(rx1.try_recv() == i);
+    }
+    REQUIRE_FALSE(rx1.try_recv().has_value());
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(rx2.try_recv() == i);
+    }
+    REQUIRE_FALSE(rx2.try_recv().has_value());
+}
+
+TEST_CASE("wmp::bus subscribe() observes only later messages")
+{
+    auto [tx, rx1] = bus::create<int>(8);
+
+    REQUIRE(bus::send_result::success == tx.try_send(1));
+    auto rx2 = tx.subscribe();
+    REQUIRE(bus::send_result::success == tx.try_send(2));
+
+    REQUIRE(rx1.try_recv() == 1);
+    REQUIRE(rx1.try_recv() == 2);
+    REQUIRE(rx2.try_recv() == 2);
+}
+
+TEST_CASE("wmp::bus backpressure is applied by the slowest receiver")
+{
+    auto [tx, fast] = bus::create<int>(2, bus::policy::backpressure);
+    auto slow = fast.clone();
+
+    REQUIRE(bus::send_result::success == tx.try_send(1));
+    REQUIRE(bus::send_result::success == tx.try_send(2));
+    REQUIRE(fast.try_recv() == 1);
+    REQUIRE(fast.try_recv() == 2);
+
+    // the slow receiver still holds both slots
+    REQUIRE(bus::send_result::failure == tx.try_send(3));
+    REQUIRE(bus::send_result::timeout == tx.send_timeout(3, std::chrono::milliseconds{10}));
+
+    REQUIRE(slow.try_recv() == 1);
+    REQUIRE(bus::send_result::success == tx.try_send(3));
+    REQUIRE(slow.lagged() == 0);
+}
+
+TEST_CASE("wmp::bus lagged receivers skip ahead and report the skip count")
+{
+    auto [tx, rx] = bus::create<int>(4, bus::policy::lagged);
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        REQUIRE(bus::send_result::success == tx.try_send(i));
+    }
+
+    // messages 0 through 5 were overwritten
+    REQUIRE(rx.try_recv() == 6);
+    REQUIRE(rx.lagged() == 6);
+    REQUIRE(rx.try_recv() == 7);
+    REQUIRE(rx.lagged() == 0);
+}
+
+TEST_CASE("wmp::bus send fails once every receiver is dropped")
+{
+    auto [tx, rx] = bus::create<int>(4);
+    {
+        auto drop = std::move(rx);
+    }
+
+    REQUIRE(bus::send_result::failure == tx.try_send(1));
+    REQUIRE(bus::send_result::failure == tx.send(1));
+}
+
+TEST_CASE("wmp::bus handles release their bus when assigned over")
+{
+    auto [tx1, rx1] = bus::create<int>(4);
+    auto [tx2, rx2] = bus::create<int>(4);
+
+    SECTION("a receiver assigned over unsubscribes")
+    {
+        rx1 = std::move(rx2);
+
+        REQUIRE(bus::send_result::failure == tx1.try_send(1));
+        REQUIRE(bus::send_result::success == tx2.try_send(2));
+        REQUIRE(rx1.try_recv() == 2);
+    }
+
+    SECTION("a sender assigned over closes the bus")
+    {
+        tx1 = std::move(tx2);
+
+        REQUIRE_FALSE(rx1.recv().has_value());
+        REQUIRE(bus::send_result::success == tx1.try_send(2));
+        REQUIRE(rx2.try_recv() == 2);
+    }
+}
+
+TEST_CASE("wmp::bus a message whose copy throws does not stall receivers")
+{
+    struct fragile
+    {
+        int value;
+
+        explicit fragile(int v)
+            : value{v} {}
+
+        fragile(fragile const& other)
+            : value{other.value}
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error{"refused"};
+            }
+        }
+
+        fragile(fragile&& other)
+            : fragile{static_cast<fragile const&>(other)} {}
+    };
+
+    auto [tx, rx] = bus::create<fragile>(2, bus::policy::backpressure);
+
+    REQUIRE_THROWS_AS(tx.try_send(fragile{-1}), std::runtime_error);
+    REQUIRE_THROWS_AS(tx.send(fragile{-2}), std::runtime_error);
+
+    // no position was claimed by the failed sends, so the ring is not filled by them
+    REQUIRE(bus::send_result::success == tx.try_send(fragile{1}));
+    REQUIRE(bus::send_result::success == tx.try_send(fragile{2}));
+
+    auto v = rx.try_recv();
+    REQUIRE(v.has_value());
+    REQUIRE(1 == v->value);
+    auto w = rx.try_recv();
+    REQUIRE(w.has_value());
+    REQUIRE(2 == w->value);
+}
+
+TEST_CASE("wmp::bus multiple producers, multiple blocking consumers")
+{
+    constexpr static auto const N_PRODUCERS = 2;
+    constexpr static auto const N_CONSUMERS = 3;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = bus::create<int>(16);
+
+    auto consumers = std::vector<std::thread>{};
+    auto sums = std::vector<long>(N_CONSUMERS, 0);
+    for (auto c = 0; c < N_CONSUMERS; ++c)
+    {
+        consumers.emplace_back(
+            [&sums, c, r = rx.clone()]() mutable
+            {
+                while (auto v = r.recv())
+                {
+                    sums[c] += v.value();
+                }
+            });
+    }
+
+    // only the clones participate
+    {
+        auto drop = std::move(rx);
+    }
+
+    auto producers = std::vector<std::thread>{};
+    for (auto p = 0; p < N_PRODUCERS; ++p)
+    {
+        producers.emplace_back(
+            [t = tx.clone()]() mutable
+            {
+                for (auto i = 1; i <= N_MESSAGES; ++i)
+                {
+                    t.send(i);
+                }
+            });
+    }
+
+    for (auto& p : producers)
+    {
+        p.join();
+    }
+
+    // the final sender handle closes the bus
+    {
+        auto drop = std::move(tx);
+    }
+
+    for (auto& c : consumers)
+    {
+        c.join();
+    }
+
+    auto const expected = long{N_PRODUCERS} * N_MESSAGES * (N_MESSAGES + 1) / 2;
+    for (auto const sum : sums)
+    {
+        REQUIRE(sum == expected);
+    }
+}
+
+TEST_CASE("wmp::bus lagged receivers never observe a message being overwritten")
+{
+    constexpr static auto const N_MESSAGES = 20000;
+
+    // counted rather than asserted on the consumer thread
+    auto torn = std::atomic<int>{0};
+
+    SECTION("trivially copyable messages")
+    {
+        struct pair
+        {
+            uint64_t value;
+            uint64_t check;
+        };
+
+        auto [tx, rx] = bus::create<pair>(2, bus::policy::lagged);
+
+        auto consumer = std::thread{
+            [&torn, r = std::move(rx)]() mutable
+            {
+                while (auto v = r.recv())
+                {
+                    torn += (v->check != ~v->value);
+                }
+            }};
+
+        for (auto i = uint64_t{0}; i < N_MESSAGES; ++i)
+        {
+            REQUIRE(bus::send_result::success == tx.try_send(pair{i, ~i}));
+        }
+
+        {
+            auto drop = std::move(tx);
+        }
+        consumer.join();
+        REQUIRE(0 == torn);
+    }
+
+    SECTION("messages that are not trivially copyable")
+    {
+        auto [tx, rx] = bus::create<std::string>(2, bus::policy::lagged);
+
+        auto consumer = std::thread{
+            [&torn, r = std::move(rx)]() mutable
+            {
+                while (auto v = r.recv())
+                {
+                    torn += (v->size() != 64 || v->find_first_not_of(v->front()) != std::string::npos);
+                }
+            }};
+
+        for (auto i = 0; i < N_MESSAGES; ++i)
+        {
+            REQUIRE(bus::send_result::success == tx.try_send(std::string(64, static_cast<char>('a' + i % 26))));
+        }
+
+        {
+            auto drop = std::move(tx);
+        }
+        consumer.join();
+        REQUIRE(0 == torn);
+    }
+}
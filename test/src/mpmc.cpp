@@ -0,0 +1,148 @@
+// mpmc.cpp
+//
+// Unit tests for wmp::mpmc
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <thread>
+
+#include <wmp/mpmc.hpp>
+
+using namespace wmp;
+
+TEST_CASE("wmp::mpmc basic non-blocking send and receive")
+{
+    auto [tx, rx] = mpmc::create<int>(2);
+
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    REQUIRE(mpmc::send_result::success == tx.try_send(1));
+    REQUIRE(mpmc::send_result::success == tx.try_send(2));
+    REQUIRE(mpmc::send_result::failure == tx.try_send(3));
+
+    // each value is delivered to exactly one receiver
+    auto rx2 = rx.clone();
+    REQUIRE(rx2.try_recv() == 1);
+    REQUIRE(rx.try_recv() == 2);
+    REQUIRE_FALSE(rx2.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpmc timeouts expire")
+{
+    auto [tx, rx] = mpmc::create<int>(1);
+
+    REQUIRE_FALSE(rx.recv_timeout(std::chrono::milliseconds{10}).has_value());
+
+    REQUIRE(mpmc::send_result::success == tx.send(1));
+    REQUIRE(mpmc::send_result::timeout == tx.send_timeout(2, std::chrono::milliseconds{10}));
+}
+
+TEST_CASE("wmp::mpmc disconnection is observed by both sides")
+{
+    SECTION("receivers drain, then observe the final sender drop")
+    {
+        auto [tx, rx] = mpmc::create<int>(4);
+        REQUIRE(mpmc::send_result::success == tx.send(1));
+        {
+            auto drop = std::move(tx);
+        }
+
+        REQUIRE(rx.recv() == 1);
+        REQUIRE_FALSE(rx.recv().has_value());
+    }
+
+    SECTION("senders fail once the final receiver drops")
+    {
+        auto [tx, rx] = mpmc::create<int>(4);
+        {
+            auto drop = std::move(rx);
+        }
+
+        REQUIRE(mpmc::send_result::failure == tx.send(1));
+        REQUIRE(mpmc::send_result::failure == tx.try_send(1));
+    }
+}
+
+TEST_CASE("wmp::mpmc handles release their channel when assigned over")
+{
+    auto [tx1, rx1] = mpmc::create<int>(4);
+    auto [tx2, rx2] = mpmc::create<int>(4);
+
+    SECTION("a sender assigned over disconnects its channel")
+    {
+        tx1 = std::move(tx2);
+
+        REQUIRE_FALSE(rx1.recv().has_value());
+        REQUIRE(mpmc::send_result::success == tx1.try_send(2));
+        REQUIRE(rx2.try_recv() == 2);
+    }
+
+    SECTION("a receiver assigned over disconnects its channel")
+    {
+        rx1 = std::move(rx2);
+
+        REQUIRE(mpmc::send_result::failure == tx1.send(1));
+        REQUIRE(mpmc::send_result::success == tx2.try_send(2));
+        REQUIRE(rx1.try_recv() == 2);
+    }
+}
+
+TEST_CASE("wmp::mpmc multiple producers, multiple blocking consumers")
+{
+    constexpr static auto const N_PRODUCERS = 3;
+    constexpr static auto const N_CONSUMERS = 4;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpmc::create<int>(16);
+
+    auto sum   = std::atomic<long>{0};
+    auto count = std::atomic<long>{0};
+
+    auto consumers = std::vector<std::thread>{};
+    for (auto c = 0; c < N_CONSUMERS; ++c)
+    {
+        consumers.emplace_back(
+            [&sum, &count, r = rx.clone()]() mutable
+            {
+                while (auto v = r.recv())
+                {
+                    sum += v.value();
+                    ++count;
+                }
+            });
+    }
+
+    auto producers = std::vector<std::thread>{};
+    for (auto p = 0; p < N_PRODUCERS; ++p)
+    {
+        producers.emplace_back(
+            [t = tx.clone()]() mutable
+            {
+                for (auto i = 1; i <= N_MESSAGES; ++i)
+                {
+                    t.send(i);
+                }
+            });
+    }
+
+    for (auto& p : producers)
+    {
+        p.join();
+    }
+
+    // the final sender handle disconnects the channel
+    {
+        auto drop = std::move(tx);
+    }
+
+    for (auto& c : consumers)
+    {
+        c.join();
+    }
+
+    REQUIRE(count.load() == long{N_PRODUCERS} * N_MESSAGES);
+    REQUIRE(sum.load() == long{N_PRODUCERS} * N_MESSAGES * (N_MESSAGES + 1) / 2);
+}
@@ -4,10 +4,59 @@
 
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+
 #include <wmp/mpsc.hpp>
 
 using namespace wmp;
 
+namespace
+{
+    // fragile - a value whose copy fails for negative values
+    struct fragile
+    {
+        int value;
+
+        explicit fragile(int v)
+            : value{v} {}
+
+        fragile(fragile const& other)
+            : value{other.value}
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error{"refused"};
+            }
+        }
+
+        fragile(fragile&&) noexcept = default;
+    };
+
+    // picky - a destination whose assignment fails for negative values
+    struct picky
+    {
+        int value = 0;
+
+        auto operator=(fragile&& other) -> picky&
+        {
+            if (other.value < 0)
+            {
+                throw std::runtime_error{"refused"};
+            }
+            value = other.value;
+            return *this;
+        }
+    };
+}
+
 TEST_CASE("wmp::mpsc basic non-blocking send and receive")
 {
     auto [tx, rx] = mpsc::create<uint8_t>(10);
@@ -77,4 +126,880 @@ TEST_CASE("wmp::mpsc sender send_timeout() expiration")
     // timeout should expire
     auto const r2 = tx.send_timeout(value, 100ms);
     REQUIRE(mpsc::send_result::timeout == r2);
-}
\ No newline at end of file
+}
+TEST_CASE("wmp::mpsc multiple blocking producers, single blocking consumer")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(8);
+
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone()]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                local.send(static_cast<uint32_t>(j));
+            }
+        });
+    }
+
+    auto sum = uint64_t{0};
+    for (auto i = 0; i < N_PRODUCERS * N_MESSAGES; ++i)
+    {
+        auto const v = rx.recv();
+        REQUIRE(v.has_value());
+        sum += v.value();
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    REQUIRE(sum == uint64_t{N_PRODUCERS} * (N_MESSAGES * uint64_t{N_MESSAGES - 1} / 2));
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpsc unbounded channel never reports full")
+{
+    constexpr static auto const N_MESSAGES = 100000;
+
+    auto [tx, rx] = mpsc::create_unbounded<uint32_t>();
+
+    for (auto i = 0; i < N_MESSAGES; ++i)
+    {
+        REQUIRE(mpsc::send_result::success == tx.try_send(static_cast<uint32_t>(i)));
+    }
+
+    for (auto i = 0; i < N_MESSAGES; ++i)
+    {
+        auto const v = rx.try_recv();
+        REQUIRE(v.has_value());
+        REQUIRE(v.value() == static_cast<uint32_t>(i));
+    }
+
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpsc unbounded channel, multiple producers, blocking consumer")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpsc::create_unbounded<uint32_t>();
+
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone()]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                local.send(static_cast<uint32_t>(j));
+            }
+        });
+    }
+
+    auto sum = uint64_t{0};
+    for (auto i = 0; i < N_PRODUCERS * N_MESSAGES; ++i)
+    {
+        auto const v = rx.recv();
+        REQUIRE(v.has_value());
+        sum += v.value();
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    REQUIRE(sum == uint64_t{N_PRODUCERS} * (N_MESSAGES * uint64_t{N_MESSAGES - 1} / 2));
+}
+
+TEST_CASE("wmp::mpsc unbounded channel recv_timeout() expiration")
+{
+    using namespace std::chrono_literals;
+
+    auto [tx, rx] = mpsc::create_unbounded<uint32_t>();
+
+    auto const v = rx.recv_timeout(50ms);
+    REQUIRE_FALSE(v.has_value());
+}
+
+TEST_CASE("wmp::mpsc recv_until() and send_until() respect absolute deadlines")
+{
+    using namespace std::chrono;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(1);
+
+    // a deadline in the past still attempts the operation once
+    REQUIRE(mpsc::send_result::success == tx.send_until(1, steady_clock::now() - 1s));
+    REQUIRE(mpsc::send_result::timeout == tx.send_until(2, steady_clock::now() + 1ms));
+
+    REQUIRE(rx.recv_until(system_clock::now() - 1s) == 1u);
+
+    auto const deadline = steady_clock::now() + 500us;
+    REQUIRE_FALSE(rx.recv_until(deadline).has_value());
+    REQUIRE(steady_clock::now() >= deadline);
+}
+
+TEST_CASE("wmp::mpsc try_send_many() enqueues only what fits")
+{
+    auto [tx, rx] = mpsc::create<uint32_t>(4);
+
+    auto const values = std::vector<uint32_t>{1, 2, 3, 4, 5, 6};
+
+    auto const sent = tx.try_send_many(values.begin(), values.end());
+    REQUIRE(4 == sent);
+
+    auto received = std::vector<uint32_t>{};
+    auto const count = rx.try_recv_many(std::back_inserter(received), 10);
+    REQUIRE(4 == count);
+    REQUIRE(received == std::vector<uint32_t>{1, 2, 3, 4});
+}
+
+TEST_CASE("wmp::mpsc try_send_many() never waits, however many producers contend")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_ATTEMPTS  = 20000;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(4);
+
+    auto sent     = std::atomic<std::size_t>{0};
+    auto stop     = std::atomic<bool>{false};
+    auto received = std::size_t{0};
+
+    auto consumer = std::thread{[&, rx = std::move(rx)]() mutable {
+        auto sink = std::vector<uint32_t>{};
+        while (!stop.load())
+        {
+            received += rx.try_recv_many(std::back_inserter(sink), 3);
+            sink.clear();
+        }
+        received += rx.try_recv_many(std::back_inserter(sink), 16);
+    }};
+
+    auto producers = std::vector<std::thread>{};
+    for (auto p = 0; p < N_PRODUCERS; ++p)
+    {
+        producers.emplace_back([&sent, t = tx.clone()]() mutable {
+            auto const batch = std::array<uint32_t, 3>{1, 2, 3};
+            for (auto i = 0; i < N_ATTEMPTS; ++i)
+            {
+                sent += t.try_send_many(batch.begin(), batch.end());
+            }
+        });
+    }
+
+    for (auto& p : producers)
+    {
+        p.join();
+    }
+
+    stop.store(true);
+    consumer.join();
+    REQUIRE(received == sent.load());
+}
+
+TEST_CASE("wmp::mpsc a value whose constructor throws does not stall the channel")
+{
+    auto [tx, rx] = mpsc::create<fragile>(8);
+
+    auto values = std::vector<fragile>{};
+    values.reserve(3);
+    values.emplace_back(1);
+    values.emplace_back(-1);
+    values.emplace_back(2);
+    REQUIRE_THROWS_AS(tx.try_send_many(values.begin(), values.end()), std::runtime_error);
+
+    // the values claimed after the throwing one are abandoned along with it
+    auto v = rx.try_recv();
+    REQUIRE(v.has_value());
+    REQUIRE(1 == v->value);
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    REQUIRE(mpsc::send_result::success == tx.try_send(fragile{3}));
+    auto const w = rx.try_recv();
+    REQUIRE(w.has_value());
+    REQUIRE(3 == w->value);
+}
+
+TEST_CASE("wmp::mpsc unbounded channel enqueues nothing from a batch whose constructor throws")
+{
+    auto [tx, rx] = mpsc::create_unbounded<fragile>();
+
+    auto values = std::vector<fragile>{};
+    values.reserve(3);
+    values.emplace_back(1);
+    values.emplace_back(-1);
+    values.emplace_back(2);
+    REQUIRE_THROWS_AS(tx.try_send_many(values.begin(), values.end()), std::runtime_error);
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    auto const failing = fragile{-1};
+    REQUIRE_THROWS_AS(tx.emplace_send(failing), std::runtime_error);
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    REQUIRE(mpsc::send_result::success == tx.try_send(fragile{3}));
+    auto const w = rx.try_recv();
+    REQUIRE(w.has_value());
+    REQUIRE(3 == w->value);
+}
+
+TEST_CASE("wmp::mpsc a batch receive that throws keeps the values not yet received")
+{
+    auto [tx, rx] = mpsc::create<fragile>(8);
+    REQUIRE(mpsc::send_result::success == tx.try_send(fragile{1}));
+    REQUIRE(mpsc::send_result::success == tx.try_send(fragile{-1}));
+    REQUIRE(mpsc::send_result::success == tx.try_send(fragile{2}));
+
+    auto received = std::array<picky, 8>{};
+    REQUIRE_THROWS_AS(rx.try_recv_many(received.begin(), received.size()), std::runtime_error);
+    REQUIRE(1 == received[0].value);
+
+    auto const v = rx.try_recv();
+    REQUIRE(v.has_value());
+    REQUIRE(-1 == v->value);
+    REQUIRE(1 == rx.try_recv_many(received.begin(), received.size()));
+    REQUIRE(2 == received[0].value);
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpsc segmented channel skips a value whose constructor throws")
+{
+    auto [tx, rx] = mpsc::create_segmented<fragile>();
+
+    SECTION("within a segment")
+    {
+        auto values = std::vector<fragile>{};
+        values.reserve(3);
+        values.emplace_back(1);
+        values.emplace_back(-1);
+        values.emplace_back(2);
+        REQUIRE_THROWS_AS(tx.try_send_many(values.begin(), values.end()), std::runtime_error);
+
+        auto v = rx.try_recv();
+        REQUIRE(v.has_value());
+        REQUIRE(1 == v->value);
+        REQUIRE_FALSE(rx.try_recv().has_value());
+    }
+
+    SECTION("in the last slot of a segment")
+    {
+        auto const failing = fragile{-1};
+        for (auto i = std::size_t{0}; i + 1 < wmp::detail::SEGMENT_CAPACITY; ++i)
+        {
+            REQUIRE(mpsc::send_result::success == tx.try_send(fragile{static_cast<int>(i)}));
+        }
+        REQUIRE_THROWS_AS(tx.emplace_send(failing), std::runtime_error);
+
+        for (auto i = std::size_t{0}; i + 1 < wmp::detail::SEGMENT_CAPACITY; ++i)
+        {
+            REQUIRE(rx.try_recv().has_value());
+        }
+        REQUIRE_FALSE(rx.try_recv().has_value());
+    }
+
+    REQUIRE(mpsc::send_result::success == tx.try_send(fragile{3}));
+    auto const w = rx.try_recv();
+    REQUIRE(w.has_value());
+    REQUIRE(3 == w->value);
+}
+
+TEST_CASE("wmp::mpsc send_many() / recv_many() across threads")
+{
+    constexpr static auto const N_MESSAGES = 10000;
+    constexpr static auto const BATCH      = 64;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(16);
+
+    auto producer = std::thread{[tx = std::move(tx)]() mutable {
+        auto batch = std::vector<uint32_t>{};
+        for (auto i = 0; i < N_MESSAGES; i += BATCH)
+        {
+            batch.clear();
+            for (auto j = i; j < i + BATCH && j < N_MESSAGES; ++j)
+            {
+                batch.push_back(static_cast<uint32_t>(j));
+            }
+            tx.send_many(batch.begin(), batch.end());
+        }
+    }};
+
+    auto received = std::vector<uint32_t>{};
+    while (received.size() < N_MESSAGES)
+    {
+        REQUIRE(rx.recv_many(std::back_inserter(received), BATCH) > 0);
+    }
+
+    producer.join();
+
+    for (auto i = 0; i < N_MESSAGES; ++i)
+    {
+        REQUIRE(received[i] == static_cast<uint32_t>(i));
+    }
+}
+
+TEST_CASE("wmp::mpsc unbounded drain() takes every queued value")
+{
+    auto [tx, rx] = mpsc::create_unbounded<uint32_t>();
+
+    auto const values = std::vector<uint32_t>{1, 2, 3, 4, 5};
+    REQUIRE(values.size() == tx.try_send_many(values.begin(), values.end()));
+    REQUIRE(mpsc::send_result::success == tx.try_send(6));
+
+    auto received = std::vector<uint32_t>{};
+    REQUIRE(6 == rx.drain(std::back_inserter(received)));
+    REQUIRE(received == std::vector<uint32_t>{1, 2, 3, 4, 5, 6});
+    REQUIRE(0 == rx.drain(std::back_inserter(received)));
+}
+
+TEST_CASE("wmp::mpsc move-only payloads")
+{
+    auto [tx, rx] = mpsc::create<std::unique_ptr<uint32_t>>(4);
+
+    REQUIRE(mpsc::send_result::success == tx.send(std::make_unique<uint32_t>(1)));
+    REQUIRE(mpsc::send_result::success == tx.emplace_send(new uint32_t{2}));
+    REQUIRE(mpsc::send_result::success == tx.try_emplace_send(new uint32_t{3}));
+
+    auto const v1 = rx.recv();
+    REQUIRE(v1.has_value());
+    REQUIRE(*v1.value() == 1);
+
+    auto const v2 = rx.try_recv();
+    REQUIRE(v2.has_value());
+    REQUIRE(*v2.value() == 2);
+
+    auto rest = std::vector<std::unique_ptr<uint32_t>>{};
+    REQUIRE(1 == rx.drain(std::back_inserter(rest)));
+    REQUIRE(*rest.front() == 3);
+}
+
+TEST_CASE("wmp::mpsc sharded channel bounds each sender separately")
+{
+    auto [tx, rx] = mpsc::create_sharded<uint32_t>(2);
+    auto tx2 = tx.clone();
+
+    REQUIRE(mpsc::send_result::success == tx.try_send(1));
+    REQUIRE(mpsc::send_result::success == tx.try_send(2));
+    REQUIRE(mpsc::send_result::failure == tx.try_send(3));
+
+    // a full sub-queue does not hold back any other sender
+    REQUIRE(mpsc::send_result::success == tx2.try_send(10));
+    REQUIRE(mpsc::send_result::success == tx2.try_send(20));
+
+    // the receiver alternates between senders, each in its own order
+    auto received = std::vector<uint32_t>{};
+    for (auto i = 0; i < 4; ++i)
+    {
+        auto const v = rx.try_recv();
+        REQUIRE(v.has_value());
+        received.push_back(v.value());
+    }
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    auto const first  = std::vector<uint32_t>{received[0], received[2]};
+    auto const second = std::vector<uint32_t>{received[1], received[3]};
+    REQUIRE((first == std::vector<uint32_t>{1, 2} || first == std::vector<uint32_t>{10, 20}));
+    REQUIRE((second == std::vector<uint32_t>{1, 2} || second == std::vector<uint32_t>{10, 20}));
+    REQUIRE(first != second);
+}
+
+TEST_CASE("wmp::mpsc sharded channel reuses the sub-queues of dropped senders")
+{
+    auto [tx, rx] = mpsc::create_sharded<uint32_t>(4);
+
+    for (auto i = 0u; i < 1000; ++i)
+    {
+        auto local = tx.clone();
+        REQUIRE(mpsc::send_result::success == local.try_send(i));
+        REQUIRE(rx.try_recv() == i);
+    }
+
+    // a dropped sender's pending values are still delivered
+    {
+        auto local = tx.clone();
+        auto const values = std::vector<uint32_t>{1, 2, 3};
+        REQUIRE(3 == local.try_send_many(values.begin(), values.end()));
+    }
+    auto received = std::vector<uint32_t>{};
+    REQUIRE(3 == rx.try_recv_many(std::back_inserter(received), 8));
+    REQUIRE(received == std::vector<uint32_t>{1, 2, 3});
+}
+
+TEST_CASE("wmp::mpsc sharded channel, multiple blocking producers, blocking consumer")
+{
+    constexpr static auto const N_PRODUCERS = 8;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpsc::create_sharded<uint32_t>(8);
+
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone(), i]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                local.send(static_cast<uint32_t>(i * N_MESSAGES + j));
+            }
+        });
+    }
+
+    // values from each producer arrive in the order they were sent
+    auto next = std::vector<uint32_t>(N_PRODUCERS, 0);
+    for (auto i = 0; i < N_PRODUCERS * N_MESSAGES; ++i)
+    {
+        auto const v = rx.recv();
+        REQUIRE(v.has_value());
+
+        auto const producer = v.value() / N_MESSAGES;
+        REQUIRE(v.value() % N_MESSAGES == next[producer]++);
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpsc priority channel drains higher priorities first")
+{
+    auto [tx, rx] = mpsc::create_priority<uint32_t, 3>(4);
+
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+    REQUIRE(mpsc::send_result::success == tx.send(2, 1));
+    REQUIRE(mpsc::send_result::success == tx.try_send(3));
+    REQUIRE(mpsc::send_result::success == tx.try_send(4, 2));
+    REQUIRE(mpsc::send_result::success == tx.send(5, 1));
+
+    // out-of-range priorities are sent at the highest
+    REQUIRE(mpsc::send_result::success == tx.send(6, 100));
+
+    auto received = std::vector<uint32_t>{};
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto const v = rx.try_recv();
+        REQUIRE(v.has_value());
+        received.push_back(v.value());
+    }
+    REQUIRE(3 == rx.try_recv_many(std::back_inserter(received), 8));
+    REQUIRE(received == std::vector<uint32_t>{4, 6, 2, 5, 1, 3});
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpsc priority channel bounds each priority separately")
+{
+    using namespace std::chrono_literals;
+
+    auto [tx, rx] = mpsc::create_priority<uint32_t, 2>(2);
+
+    REQUIRE(mpsc::send_result::success == tx.try_send(1));
+    REQUIRE(mpsc::send_result::success == tx.try_send(2));
+    REQUIRE(mpsc::send_result::failure == tx.try_send(3));
+    REQUIRE(mpsc::send_result::timeout == tx.send_timeout(3, 0, 10ms));
+    REQUIRE(mpsc::send_result::timeout == tx.send_until(3, 0, std::chrono::steady_clock::now() + 1ms));
+
+    // a backlog of low priority values never holds back a high priority one
+    REQUIRE(mpsc::send_result::success == tx.send_timeout(10, 1, 10ms));
+    REQUIRE(mpsc::send_result::success == tx.send_until(11, 1, std::chrono::steady_clock::now() + 10ms));
+    REQUIRE(rx.recv() == 10);
+    REQUIRE(rx.recv() == 11);
+    REQUIRE(rx.recv() == 1);
+}
+
+TEST_CASE("wmp::mpsc priority channel, multiple producers, blocking consumer")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpsc::create_priority<uint32_t, 4>(8);
+
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone(), i]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                local.send(static_cast<uint32_t>(i * N_MESSAGES + j), static_cast<std::size_t>(i));
+            }
+        });
+    }
+
+    // values of a single priority arrive in the order they were sent
+    auto next = std::vector<uint32_t>(N_PRODUCERS, 0);
+    for (auto i = 0; i < N_PRODUCERS * N_MESSAGES; ++i)
+    {
+        auto const v = rx.recv();
+        REQUIRE(v.has_value());
+
+        auto const priority = v.value() / N_MESSAGES;
+        REQUIRE(v.value() % N_MESSAGES == next[priority]++);
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::mpsc drop_newest overflow discards values sent to a full channel")
+{
+    using namespace std::chrono_literals;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(2, mpsc::overflow::drop_newest);
+
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+    REQUIRE(mpsc::send_result::success == tx.send(2));
+
+    // sends never block; the values that do not fit are counted
+    REQUIRE(mpsc::send_result::failure == tx.send(3));
+    REQUIRE(mpsc::send_result::failure == tx.send_timeout(4, 1h));
+    REQUIRE(mpsc::send_result::failure == tx.try_send(5));
+
+    auto const values = std::vector<uint32_t>{6, 7};
+    REQUIRE(0 == tx.try_send_many(values.begin(), values.end()));
+    REQUIRE(5 == rx.dropped());
+
+    auto received = std::vector<uint32_t>{};
+    REQUIRE(2 == rx.drain(std::back_inserter(received)));
+    REQUIRE(received == std::vector<uint32_t>{1, 2});
+}
+
+TEST_CASE("wmp::mpsc drop_oldest overflow keeps the most recent values")
+{
+    using namespace std::chrono_literals;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(4, mpsc::overflow::overwrite);
+
+    for (auto i = 0u; i < 10; ++i)
+    {
+        REQUIRE(mpsc::send_result::success == tx.send(i));
+    }
+    REQUIRE(mpsc::send_result::success == tx.send_timeout(10, 1h));
+    REQUIRE(mpsc::send_result::success == tx.emplace_send(11u));
+
+    auto const values = std::vector<uint32_t>{12, 13};
+    REQUIRE(2 == tx.try_send_many(values.begin(), values.end()));
+    REQUIRE(10 == rx.dropped());
+
+    REQUIRE(rx.recv() == 10);
+    auto received = std::vector<uint32_t>{};
+    REQUIRE(3 == rx.drain(std::back_inserter(received)));
+    REQUIRE(received == std::vector<uint32_t>{11, 12, 13});
+    REQUIRE_FALSE(rx.recv_timeout(10ms).has_value());
+}
+
+TEST_CASE("wmp::mpsc drop_oldest overflow, multiple producers, blocking consumer")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpsc::create<uint32_t>(8, mpsc::overflow::drop_oldest);
+
+    auto failed    = std::atomic<int>{0};
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone(), i, &failed]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                if (mpsc::send_result::success != local.send(static_cast<uint32_t>(i * N_MESSAGES + j)))
+                {
+                    failed.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    // every value is either received, in order per producer, or dropped
+    auto done       = std::atomic<bool>{false};
+    auto received   = uint64_t{0};
+    auto misordered = uint64_t{0};
+    auto consumer = std::thread{[&rx = rx, &done, &received, &misordered]() {
+        auto last = std::vector<int64_t>(N_PRODUCERS, -1);
+        for (;;)
+        {
+            auto const finished = done.load();
+            auto const v        = rx.recv_timeout(std::chrono::milliseconds{1});
+            if (!v.has_value())
+            {
+                if (finished)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            auto const producer = v.value() / N_MESSAGES;
+            auto const index    = static_cast<int64_t>(v.value() % N_MESSAGES);
+            if (index <= last[producer])
+            {
+                ++misordered;
+            }
+            last[producer] = index;
+            ++received;
+        }
+    }};
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+    done.store(true);
+    consumer.join();
+
+    REQUIRE(0 == failed.load());
+    REQUIRE(0 == misordered);
+    REQUIRE(received + rx.dropped() == uint64_t{N_PRODUCERS} * N_MESSAGES);
+}
+
+TEST_CASE("wmp::mpsc segmented channel shrinks back after a burst")
+{
+    constexpr static auto const N_MESSAGES = 1000;
+
+    auto pool = mpsc::segment_pool<uint32_t>{};
+    auto [tx, rx] = mpsc::create_segmented(pool);
+
+    auto const idle = rx.footprint();
+    REQUIRE(idle > 0);
+
+    for (auto i = 0u; i < N_MESSAGES; ++i)
+    {
+        REQUIRE(mpsc::send_result::success == tx.send(i));
+    }
+    REQUIRE(rx.footprint() >= N_MESSAGES * sizeof(uint32_t));
+
+    for (auto i = 0u; i < N_MESSAGES; ++i)
+    {
+        REQUIRE(rx.try_recv() == i);
+    }
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    // the drained segments went back to the pool, for any channel to reuse
+    REQUIRE(rx.footprint() == idle);
+    REQUIRE(pool.available() > 0);
+
+    auto [tx2, rx2] = mpsc::create_segmented(pool);
+    auto const values = std::vector<uint32_t>{1, 2, 3};
+    REQUIRE(3 == tx2.try_send_many(values.begin(), values.end()));
+
+    auto received = std::vector<uint32_t>{};
+    REQUIRE(3 == rx2.drain(std::back_inserter(received)));
+    REQUIRE(received == values);
+
+    pool.trim();
+    REQUIRE(0 == pool.available());
+}
+
+TEST_CASE("wmp::mpsc segmented channel, multiple producers, blocking consumer")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_MESSAGES  = 10000;
+
+    auto [tx, rx] = mpsc::create_segmented<uint32_t>();
+
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone(), i]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                local.send(static_cast<uint32_t>(i * N_MESSAGES + j));
+            }
+        });
+    }
+
+    // values from each producer arrive in the order they were sent
+    auto next = std::vector<uint32_t>(N_PRODUCERS, 0);
+    for (auto i = 0; i < N_PRODUCERS * N_MESSAGES; ++i)
+    {
+        auto const v = rx.recv();
+        REQUIRE(v.has_value());
+
+        auto const producer = v.value() / N_MESSAGES;
+        REQUIRE(v.value() % N_MESSAGES == next[producer]++);
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+namespace
+{
+    struct tick
+    {
+        uint32_t sequence;
+    };
+
+    struct large_report
+    {
+        std::array<uint64_t, 32> samples;
+    };
+
+    // counts live instances, to check that no message is leaked or destroyed twice
+    struct tracked
+    {
+        static inline auto live = 0;
+
+        std::unique_ptr<uint32_t> value;
+        uint64_t                  padding[3] = {};
+
+        explicit tracked(uint32_t const v)
+            : value{std::make_unique<uint32_t>(v)}
+        {
+            ++live;
+        }
+
+        tracked(tracked&& other) noexcept
+            : value{std::move(other.value)}
+        {
+            ++live;
+        }
+
+        ~tracked()
+        {
+            --live;
+        }
+    };
+}
+
+TEST_CASE("wmp::mpsc any channel stores small messages inline and dispatches by type")
+{
+    using message = mpsc::any_message<32>;
+    STATIC_REQUIRE(message::stored_inline<tick>());
+    STATIC_REQUIRE_FALSE(message::stored_inline<large_report>());
+
+    auto [tx, rx] = mpsc::create_any<32>(8);
+
+    REQUIRE(mpsc::send_result::success == tx.send(tick{1}));
+    REQUIRE(mpsc::send_result::success == tx.send(large_report{{7}}));
+    REQUIRE(mpsc::send_result::success == tx.emplace_send(std::in_place_type<std::string>, "hello"));
+    REQUIRE(mpsc::send_result::success == tx.try_send(3.5));
+
+    auto ticks   = uint32_t{0};
+    auto samples = uint64_t{0};
+    auto text    = std::string{};
+    auto const visitor = [&](auto& value) {
+        using type = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<type, tick>)
+        {
+            ticks += value.sequence;
+        }
+        else if constexpr (std::is_same_v<type, large_report>)
+        {
+            samples += value.samples[0];
+        }
+        else
+        {
+            text = value;
+        }
+    };
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto msg = rx.recv();
+        REQUIRE(msg.has_value());
+        REQUIRE(msg->visit<tick, large_report, std::string>(visitor));
+    }
+    REQUIRE(1 == ticks);
+    REQUIRE(7 == samples);
+    REQUIRE("hello" == text);
+
+    // a message of a type the visitor does not handle is left alone
+    auto msg = rx.try_recv();
+    REQUIRE(msg.has_value());
+    REQUIRE_FALSE(msg->visit<tick, large_report>(visitor));
+    REQUIRE(msg->is<double>());
+    REQUIRE(3.5 == msg->get<double>());
+    REQUIRE(nullptr == msg->get_if<tick>());
+}
+
+TEST_CASE("wmp::mpsc any channel destroys every message exactly once")
+{
+    STATIC_REQUIRE(mpsc::any_message<64>::stored_inline<tracked>());
+    STATIC_REQUIRE_FALSE(mpsc::any_message<16>::stored_inline<tracked>());
+
+    {
+        auto [tx, rx] = mpsc::create_any<64>(4);
+        auto [big_tx, big_rx] = mpsc::create_any<16>(4);
+
+        for (auto i = 0u; i < 4; ++i)
+        {
+            REQUIRE(mpsc::send_result::success == tx.send(tracked{i}));
+            REQUIRE(mpsc::send_result::success == big_tx.emplace_send(std::in_place_type<tracked>, i));
+        }
+
+        auto msg = rx.recv();
+        REQUIRE(msg.has_value());
+        REQUIRE(0 == *msg->get<tracked>().value);
+
+        auto moved = std::move(msg.value());
+        REQUIRE_FALSE(msg->has_value());
+        REQUIRE(moved.has_value());
+        REQUIRE(0 == *moved.get<tracked>().value);
+
+        // three messages are still queued in each channel when it is destroyed
+        REQUIRE(big_rx.try_recv().has_value());
+    }
+
+    REQUIRE(0 == tracked::live);
+}
+
+TEST_CASE("wmp::mpsc any channel across threads")
+{
+    constexpr static auto const N_PRODUCERS = 4;
+    constexpr static auto const N_MESSAGES  = 5000;
+
+    auto [tx, rx] = mpsc::create_any<16>(16);
+
+    auto producers = std::vector<std::thread>{};
+    for (auto i = 0; i < N_PRODUCERS; ++i)
+    {
+        producers.emplace_back([local = tx.clone(), i]() mutable {
+            for (auto j = 0; j < N_MESSAGES; ++j)
+            {
+                if (i % 2 == 0)
+                {
+                    local.send(tick{static_cast<uint32_t>(j)});
+                }
+                else
+                {
+                    local.send(large_report{{static_cast<uint64_t>(j)}});
+                }
+            }
+        });
+    }
+
+    auto sum = uint64_t{0};
+    for (auto i = 0; i < N_PRODUCERS * N_MESSAGES; ++i)
+    {
+        auto msg = rx.recv();
+        REQUIRE(msg.has_value());
+        REQUIRE(msg->visit<tick, large_report>([&](auto const& value) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, tick>)
+            {
+                sum += value.sequence;
+            }
+            else
+            {
+                sum += value.samples[0];
+            }
+        }));
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+
+    REQUIRE(sum == uint64_t{N_PRODUCERS} * (N_MESSAGES * uint64_t{N_MESSAGES - 1} / 2));
+}
@@ -0,0 +1,192 @@
+// native_handle.cpp
+//
+// Unit tests for the pollable native handles of wmp receivers
+
+#include <catch2/catch.hpp>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include <thread>
+
+#include <wmp/mpsc.hpp>
+#include <wmp/watch.hpp>
+#include <wmp/oneshot.hpp>
+
+using namespace wmp;
+
+namespace
+{
+    // signaled() - whether the handle is signaled, waiting up to `timeout_ms`
+    template <typename Handle>
+    auto signaled(Handle handle, int const timeout_ms = 0) -> bool
+    {
+#if defined(_WIN32)
+        return WAIT_OBJECT_0 == ::WaitForSingleObject(handle, static_cast<DWORD>(timeout_ms));
+#else
+        auto fds = pollfd{handle, POLLIN, 0};
+        return 1 == ::poll(&fds, 1, timeout_ms) && (fds.revents & POLLIN);
+#endif
+    }
+}
+
+TEST_CASE("wmp::mpsc native handle is signaled while values are available")
+{
+    auto [tx, rx] = mpsc::create<int>(8);
+    auto const handle = rx.native_handle();
+    REQUIRE_FALSE(signaled(handle));
+
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+    REQUIRE(mpsc::send_result::success == tx.send(2));
+    REQUIRE(signaled(handle));
+
+    // the signal survives until the channel is found empty
+    REQUIRE(rx.try_recv() == 1);
+    REQUIRE(signaled(handle));
+    REQUIRE(rx.try_recv() == 2);
+    REQUIRE(signaled(handle));
+    REQUIRE_FALSE(rx.try_recv().has_value());
+    REQUIRE_FALSE(signaled(handle));
+}
+
+#if !defined(_WIN32)
+TEST_CASE("wmp::mpsc native handle is written once per empty-to-nonempty transition")
+{
+    auto [tx, rx] = mpsc::create<int>(128);
+    auto const handle = rx.native_handle();
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        REQUIRE(mpsc::send_result::success == tx.send(i));
+    }
+
+    // an eventfd accumulates every write it receives
+    auto count = uint64_t{0};
+    REQUIRE(sizeof(count) == ::read(handle, &count, sizeof(count)));
+    REQUIRE(1 == count);
+}
+#endif
+
+TEST_CASE("wmp::mpsc native handle accounts for values sent before its creation")
+{
+    auto [tx, rx] = mpsc::create_unbounded<int>();
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+
+    auto const handle = rx.native_handle();
+    REQUIRE(signaled(handle));
+    REQUIRE(rx.native_handle() == handle);
+}
+
+TEST_CASE("wmp::mpsc native handle wakes a poller on another thread")
+{
+    auto [tx, rx] = mpsc::create<int>(8);
+    auto const handle = rx.native_handle();
+
+    auto t = std::thread{[&tx = tx]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        tx.send(1);
+    }};
+
+    REQUIRE(signaled(handle, 5000));
+    t.join();
+    REQUIRE(rx.try_recv() == 1);
+}
+
+TEST_CASE("wmp::oneshot native handle is signaled on send or close")
+{
+    SECTION("send")
+    {
+        auto [tx, rx] = oneshot::create<int>();
+        auto const handle = rx.native_handle();
+        REQUIRE_FALSE(signaled(handle));
+
+        REQUIRE(oneshot::send_result::success == tx.send_async(1));
+        REQUIRE(signaled(handle));
+        REQUIRE(rx.try_recv() == 1);
+    }
+
+    SECTION("close")
+    {
+        auto [tx, rx] = oneshot::create<int>();
+        auto const handle = rx.native_handle();
+
+        tx.close();
+        REQUIRE(signaled(handle));
+        REQUIRE_FALSE(rx.recv().has_value());
+    }
+}
+
+TEST_CASE("wmp::watch native handle is signaled while an update is unseen")
+{
+    auto [tx, rx] = watch::create<int>(0);
+
+    // the initial value has not been received yet
+    auto const handle = rx.native_handle();
+    REQUIRE(signaled(handle));
+    REQUIRE(rx.recv() == 0);
+    REQUIRE_FALSE(signaled(handle));
+
+    REQUIRE(watch::send_result::success == tx.broadcast(1));
+    REQUIRE(watch::send_result::success == tx.broadcast(2));
+    REQUIRE(signaled(handle));
+    REQUIRE(rx.recv() == 2);
+    REQUIRE_FALSE(signaled(handle));
+
+    {
+        auto drop = std::move(tx);
+    }
+    REQUIRE(signaled(handle));
+}
+
+TEST_CASE("wmp receivers with a native handle may be assigned over")
+{
+    // the assigned-over receiver may hold the last reference to its channel,
+    // whose waiter list its native handle must leave before it is freed
+    SECTION("mpsc")
+    {
+        auto [tx, rx]   = mpsc::create<int>(8);
+        auto [tx2, rx2] = mpsc::create<int>(8);
+        rx.native_handle();
+        {
+            auto drop = std::move(tx);
+        }
+
+        rx = std::move(rx2);
+        REQUIRE(mpsc::send_result::success == tx2.send(1));
+        REQUIRE(signaled(rx.native_handle()));
+        REQUIRE(rx.try_recv() == 1);
+    }
+
+    SECTION("oneshot")
+    {
+        auto [tx, rx]   = oneshot::create<int>();
+        auto [tx2, rx2] = oneshot::create<int>();
+        rx.native_handle();
+        {
+            auto drop = std::move(tx);
+        }
+
+        rx = std::move(rx2);
+        REQUIRE(oneshot::send_result::success == tx2.send_async(1));
+        REQUIRE(signaled(rx.native_handle()));
+        REQUIRE(rx.try_recv() == 1);
+    }
+
+    SECTION("watch")
+    {
+        auto [tx, rx]   = watch::create<int>(0);
+        auto [tx2, rx2] = watch::create<int>(0);
+        rx.native_handle();
+        {
+            auto drop = std::move(tx);
+        }
+
+        rx = std::move(rx2);
+        REQUIRE(signaled(rx.native_handle()));
+        REQUIRE(rx.recv() == 0);
+    }
+}
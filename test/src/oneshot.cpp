@@ -4,6 +4,11 @@
 
 #include <catch2/catch.hpp>
 
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <utility>
+
 #include <wmp/oneshot.hpp>
 
 using namespace wmp;
@@ -58,4 +63,156 @@ TEST_CASE("wmp::oneshot single-threaded receiver explicit close(), sender send_s
 
     auto const r = tx.send_sync(42);
     REQUIRE(oneshot::send_result::failure == r);
-}
\ No newline at end of file
+}
+TEST_CASE("wmp::oneshot move-only payload with emplace_async()")
+{
+    auto [tx, rx] = oneshot::create<std::unique_ptr<uint32_t>>();
+
+    auto const r = tx.emplace_async(new uint32_t{42});
+    REQUIRE(oneshot::send_result::success == r);
+
+    auto const v = rx.try_recv();
+    REQUIRE(v.has_value());
+    REQUIRE(*v.value() == 42);
+}
+
+TEST_CASE("wmp::oneshot blocking recv() across threads")
+{
+    auto [tx, rx] = oneshot::create<uint32_t>();
+
+    auto producer = std::thread{[tx = std::move(tx)]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        tx.send_async(42);
+    }};
+
+    auto const v = rx.recv();
+    producer.join();
+
+    REQUIRE(v.has_value());
+    REQUIRE(v.value() == 42);
+}
+
+TEST_CASE("wmp::oneshot recv_timeout() expires, then still receives a later value")
+{
+    using namespace std::chrono;
+
+    auto [tx, rx] = oneshot::create<int>();
+
+    auto const start = steady_clock::now();
+    REQUIRE_FALSE(rx.recv_timeout(300us).has_value());
+    REQUIRE(steady_clock::now() - start >= 300us);
+
+    auto t = std::thread{[tx = std::move(tx)]() mutable {
+        std::this_thread::sleep_for(milliseconds{10});
+        tx.send_async(1);
+    }};
+
+    REQUIRE(rx.recv_until(steady_clock::now() + 10s) == 1);
+    t.join();
+}
+
+TEST_CASE("wmp::oneshot send_sync() completes when the value is received")
+{
+    auto [tx, rx] = oneshot::create<uint32_t>();
+
+    auto result = oneshot::send_result::failure;
+    auto producer = std::thread{[&result, tx = std::move(tx)]() mutable {
+        result = tx.send_sync(42);
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    REQUIRE(rx.recv() == 42u);
+
+    producer.join();
+    REQUIRE(oneshot::send_result::success == result);
+}
+
+TEST_CASE("wmp::oneshot send_sync() fails when the receiver drops without receiving")
+{
+    auto [tx, rx] = oneshot::create<uint32_t>();
+
+    auto result = oneshot::send_result::success;
+    auto producer = std::thread{[&result, tx = std::move(tx)]() mutable {
+        result = tx.send_sync(42);
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    {
+        auto drop = std::move(rx);
+    }
+
+    producer.join();
+    REQUIRE(oneshot::send_result::failure == result);
+}
+
+TEST_CASE("wmp::oneshot value sent before close() is still available to try_recv()")
+{
+    auto [tx, rx] = oneshot::create<uint32_t>();
+
+    REQUIRE(oneshot::send_result::success == tx.send_async(42));
+    tx.close();
+    rx.close();
+
+    REQUIRE(rx.try_recv() == 42u);
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::oneshot a value that is never received is destroyed")
+{
+    auto payload = std::make_shared<uint32_t>(42);
+    {
+        auto [tx, rx] = oneshot::create<std::shared_ptr<uint32_t>>();
+        REQUIRE(oneshot::send_result::success == tx.send_async(payload));
+        REQUIRE(payload.use_count() == 2);
+    }
+
+    REQUIRE(payload.use_count() == 1);
+}
+
+TEST_CASE("wmp::oneshot channels created from a pool recycle their state")
+{
+    auto p = oneshot::pool<uint32_t>{};
+    REQUIRE(p.available() == 0);
+
+    for (auto i = 0u; i < 4; ++i)
+    {
+        auto [tx, rx] = oneshot::create(p);
+        REQUIRE(oneshot::send_result::success == tx.send_async(i));
+        REQUIRE(rx.recv() == i);
+    }
+
+    // the state of the final channel was returned to the pool, and every
+    // earlier channel reused it
+    REQUIRE(p.available() == 1);
+
+    {
+        auto [tx, rx] = oneshot::create(p);
+        REQUIRE(p.available() == 0);
+
+        // the state is only recycled once both handles are dropped
+        {
+            auto drop = std::move(tx);
+        }
+        REQUIRE(p.available() == 0);
+    }
+
+    REQUIRE(p.available() == 1);
+}
+
+TEST_CASE("wmp::oneshot move-assigning a sender closes the channel it held")
+{
+    using namespace std::chrono;
+
+    auto [tx1, rx1] = oneshot::create<uint8_t>();
+    auto [tx2, rx2] = oneshot::create<uint8_t>();
+
+    tx1 = std::move(tx2);
+
+    // the first channel is closed, so its receiver returns without waiting
+    auto const start = steady_clock::now();
+    REQUIRE_FALSE(rx1.recv_timeout(10s).has_value());
+    REQUIRE(steady_clock::now() - start < 10s);
+
+    REQUIRE(oneshot::send_result::success == tx1.send_async(42));
+    REQUIRE(rx2.try_recv() == 42);
+}
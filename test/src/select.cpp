@@ -0,0 +1,145 @@
+// select.cpp
+//
+// Unit tests for wmp::select()
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <wmp/mpsc.hpp>
+#include <wmp/watch.hpp>
+#include <wmp/select.hpp>
+#include <wmp/oneshot.hpp>
+
+using namespace wmp;
+
+TEST_CASE("wmp::select reports a receiver that is already ready")
+{
+    auto [mtx, mrx] = mpsc::create<int>(4);
+    auto [otx, orx] = oneshot::create<int>();
+    auto [wtx, wrx] = watch::create<int>(0);
+
+    // a fresh watch receiver has not yet seen the initial value
+    REQUIRE(2 == select(mrx, orx, wrx));
+    REQUIRE(wrx.recv() == 0);
+
+    REQUIRE(mpsc::send_result::success == mtx.send(1));
+    REQUIRE(0 == select(mrx, orx, wrx));
+    REQUIRE(mrx.try_recv() == 1);
+
+    REQUIRE(oneshot::send_result::success == otx.send_async(2));
+    REQUIRE(1 == select(mrx, orx, wrx));
+    REQUIRE(orx.try_recv() == 2);
+}
+
+TEST_CASE("wmp::select_timeout expires when no receiver is ready")
+{
+    auto [mtx, mrx] = mpsc::create_unbounded<int>();
+    auto [wtx, wrx] = watch::create<int>(0);
+    REQUIRE(wrx.recv() == 0);
+
+    REQUIRE_FALSE(select_timeout(std::chrono::milliseconds{10}, mrx, wrx).has_value());
+}
+
+TEST_CASE("wmp::select wakes on a send from another thread")
+{
+    auto [mtx, mrx] = mpsc::create<int>(4);
+    auto [otx, orx] = oneshot::create<int>();
+    auto [wtx, wrx] = watch::create<int>(0);
+    REQUIRE(wrx.recv() == 0);
+
+    SECTION("mpsc")
+    {
+        auto t = std::thread{[&tx = mtx]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            tx.send(1);
+        }};
+
+        REQUIRE(0 == select(mrx, orx, wrx));
+        t.join();
+        REQUIRE(mrx.try_recv() == 1);
+    }
+
+    SECTION("oneshot")
+    {
+        auto t = std::thread{[&tx = otx]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            tx.send_async(2);
+        }};
+
+        REQUIRE(1 == select(mrx, orx, wrx));
+        t.join();
+        REQUIRE(orx.try_recv() == 2);
+    }
+
+    SECTION("watch")
+    {
+        auto t = std::thread{[&tx = wtx]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            tx.broadcast(3);
+        }};
+
+        REQUIRE(2 == select(mrx, orx, wrx));
+        t.join();
+        REQUIRE(wrx.recv() == 3);
+    }
+}
+
+TEST_CASE("wmp::select treats closure as readiness")
+{
+    auto [otx, orx] = oneshot::create<int>();
+    auto [wtx, wrx] = watch::create<int>(0);
+    REQUIRE(wrx.recv() == 0);
+
+    SECTION("oneshot sender closes without sending")
+    {
+        auto t = std::thread{[tx = std::move(otx)]() mutable {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            tx.close();
+        }};
+
+        REQUIRE(0 == select(orx, wrx));
+        t.join();
+        REQUIRE_FALSE(orx.recv().has_value());
+    }
+
+    SECTION("watch sender is dropped")
+    {
+        auto t = std::thread{[tx = std::move(wtx)]() mutable {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            auto drop = std::move(tx);
+        }};
+
+        REQUIRE(1 == select(orx, wrx));
+        t.join();
+        REQUIRE_FALSE(wrx.recv().has_value());
+    }
+}
+
+TEST_CASE("wmp::select leaves no waiter registered once it returns")
+{
+    auto [tx, rx] = mpsc::create<int>(64);
+
+    // repeated selects against a busy sender; a stale registration would
+    // be signaled after its waiter went out of scope
+    auto t = std::thread{[&tx = tx]() {
+        for (auto i = 0; i < 1000; ++i)
+        {
+            tx.send(i);
+        }
+    }};
+
+    auto received = 0;
+    while (received < 1000)
+    {
+        select(rx);
+        while (rx.try_recv().has_value())
+        {
+            ++received;
+        }
+    }
+
+    t.join();
+    REQUIRE(1000 == received);
+}
@@ -0,0 +1,130 @@
+// spsc.cpp
+//
+// Unit tests for wmp::spsc
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include <wmp/spsc.hpp>
+
+using namespace wmp;
+
+namespace
+{
+    template <typename S, typename = void>
+    struct is_clonable : std::false_type {};
+
+    template <typename S>
+    struct is_clonable<S, std::void_t<decltype(std::declval<S&>().clone())>> : std::true_type {};
+
+    // picky - a destination whose assignment fails for negative values
+    struct picky
+    {
+        int value = 0;
+
+        auto operator=(int const other) -> picky&
+        {
+            if (other < 0)
+            {
+                throw std::runtime_error{"refused"};
+            }
+            value = other;
+            return *this;
+        }
+    };
+}
+
+TEST_CASE("wmp::spsc sender is neither copyable nor clonable")
+{
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<spsc::sender<int>>);
+    STATIC_REQUIRE_FALSE(is_clonable<spsc::sender<int>>::value);
+    STATIC_REQUIRE(std::is_move_constructible_v<spsc::sender<int>>);
+}
+
+TEST_CASE("wmp::spsc basic non-blocking send and receive")
+{
+    auto [tx, rx] = spsc::create<int>(2);
+
+    REQUIRE_FALSE(rx.try_recv().has_value());
+
+    REQUIRE(spsc::send_result::success == tx.try_send(1));
+    REQUIRE(spsc::send_result::success == tx.try_send(2));
+    REQUIRE(spsc::send_result::failure == tx.try_send(3));
+    REQUIRE(spsc::send_result::timeout == tx.send_timeout(3, std::chrono::milliseconds{10}));
+
+    REQUIRE(rx.try_recv() == 1);
+    REQUIRE(rx.try_recv() == 2);
+    REQUIRE_FALSE(rx.recv_timeout(std::chrono::milliseconds{10}).has_value());
+}
+
+TEST_CASE("wmp::spsc batched send and receive")
+{
+    auto [tx, rx] = spsc::create<int>(4);
+
+    auto const in = std::vector<int>{1, 2, 3, 4, 5, 6};
+    REQUIRE(tx.try_send_many(in.begin(), in.end()) == 4);
+
+    auto out = std::vector<int>{};
+    REQUIRE(rx.drain(std::back_inserter(out)) == 4);
+    REQUIRE(out == std::vector<int>{1, 2, 3, 4});
+}
+
+TEST_CASE("wmp::spsc a batch receive that throws keeps the values not yet received")
+{
+    auto [tx, rx] = spsc::create<int>(4);
+
+    auto const in = std::vector<int>{1, -1, 2};
+    REQUIRE(tx.try_send_many(in.begin(), in.end()) == 3);
+
+    auto out = std::array<picky, 4>{};
+    REQUIRE_THROWS_AS(rx.try_recv_many(out.begin(), out.size()), std::runtime_error);
+    REQUIRE(1 == out[0].value);
+
+    REQUIRE(rx.try_recv() == -1);
+    REQUIRE(rx.try_recv_many(out.begin(), out.size()) == 1);
+    REQUIRE(2 == out[0].value);
+    REQUIRE_FALSE(rx.try_recv().has_value());
+}
+
+TEST_CASE("wmp::spsc move-only payloads")
+{
+    auto [tx, rx] = spsc::create<std::unique_ptr<int>>(2);
+
+    REQUIRE(spsc::send_result::success == tx.send(std::make_unique<int>(1)));
+    REQUIRE(spsc::send_result::success == tx.emplace_send(new int{2}));
+
+    REQUIRE(*rx.recv().value() == 1);
+    REQUIRE(*rx.recv().value() == 2);
+}
+
+TEST_CASE("wmp::spsc blocking producer and consumer preserve order")
+{
+    constexpr static auto const N_MESSAGES = 100000;
+
+    auto [tx, rx] = spsc::create<int>(16);
+
+    auto producer = std::thread{[t = std::move(tx)]() mutable
+    {
+        for (auto i = 0; i < N_MESSAGES; ++i)
+        {
+            t.send(i);
+        }
+    }};
+
+    auto in_order = true;
+    for (auto i = 0; i < N_MESSAGES; ++i)
+    {
+        in_order = in_order && rx.recv() == i;
+    }
+
+    producer.join();
+    REQUIRE(in_order);
+}
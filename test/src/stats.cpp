@@ -0,0 +1,173 @@
+// stats.cpp
+//
+// Unit tests for channel runtime statistics; requires WMP_COLLECT_STATS.
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iterator>
+
+#include <wmp/mpsc.hpp>
+#include <wmp/watch.hpp>
+#include <wmp/oneshot.hpp>
+
+using namespace wmp;
+using namespace std::chrono_literals;
+
+TEST_CASE("wmp::mpsc counts messages, depth and high-water")
+{
+    auto [tx, rx] = mpsc::create<int>(8);
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        REQUIRE(mpsc::send_result::success == tx.send(i));
+    }
+
+    auto const values = std::vector<int>{5, 6};
+    REQUIRE(2 == tx.try_send_many(values.begin(), values.end()));
+
+    REQUIRE(rx.recv() == 0);
+    auto out = std::vector<int>{};
+    REQUIRE(3 == rx.try_recv_many(std::back_inserter(out), 3));
+
+    auto const stats = rx.stats();
+    REQUIRE(7 == stats.sent);
+    REQUIRE(4 == stats.received);
+    REQUIRE(3 == stats.depth);
+    REQUIRE(7 == stats.high_water);
+    REQUIRE(0 == stats.sender_blocks);
+    REQUIRE(0 == stats.receiver_parks);
+
+    // every handle reports the same channel
+    REQUIRE(tx.stats().sent == stats.sent);
+}
+
+TEST_CASE("wmp::mpsc counts depth on an unbounded channel")
+{
+    auto [tx, rx] = mpsc::create_unbounded<int>();
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        tx.send(i);
+    }
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(rx.try_recv() == i);
+    }
+
+    auto const stats = rx.stats();
+    REQUIRE(10 == stats.sent);
+    REQUIRE(4 == stats.received);
+    REQUIRE(6 == stats.depth);
+    REQUIRE(10 == stats.high_water);
+}
+
+TEST_CASE("wmp::mpsc counts blocked senders and parked receivers")
+{
+    auto [tx, rx] = mpsc::create<int>(1);
+
+    // the receiver parks on an empty channel until the deadline
+    REQUIRE_FALSE(rx.recv_timeout(20ms).has_value());
+    REQUIRE(1 == rx.stats().receiver_parks);
+    REQUIRE(rx.stats().blocked_time >= 20ms);
+
+    // the sender blocks on a full channel until the deadline
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+    REQUIRE(mpsc::send_result::timeout == tx.send_timeout(2, 20ms));
+
+    auto const stats = tx.stats();
+    REQUIRE(1 == stats.sender_blocks);
+    REQUIRE(1 == stats.sent);
+    REQUIRE(stats.blocked_time >= 40ms);
+}
+
+TEST_CASE("wmp::mpsc sums counters across sending threads")
+{
+    constexpr static auto const PRODUCERS = 4;
+    constexpr static auto const MESSAGES  = 1000;
+
+    auto [tx, rx] = mpsc::create<int>(16);
+
+    auto producers = std::vector<std::thread>{};
+    for (auto p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([sender = tx.clone()]() mutable {
+            for (auto i = 0; i < MESSAGES; ++i)
+            {
+                sender.send(i);
+            }
+        });
+    }
+
+    for (auto i = 0; i < PRODUCERS * MESSAGES; ++i)
+    {
+        REQUIRE(rx.recv().has_value());
+    }
+    for (auto& p : producers)
+    {
+        p.join();
+    }
+
+    auto const stats = rx.stats();
+    REQUIRE(PRODUCERS * MESSAGES == stats.sent);
+    REQUIRE(PRODUCERS * MESSAGES == stats.received);
+    REQUIRE(0 == stats.depth);
+    REQUIRE(stats.high_water <= 16);
+}
+
+TEST_CASE("wmp::oneshot counts its single message")
+{
+    auto [tx, rx] = oneshot::create<int>();
+
+    REQUIRE(0 == tx.stats().sent);
+    REQUIRE(oneshot::send_result::success == tx.send_async(42));
+
+    auto stats = rx.stats();
+    REQUIRE(1 == stats.sent);
+    REQUIRE(0 == stats.received);
+    REQUIRE(1 == stats.depth);
+    REQUIRE(1 == stats.high_water);
+
+    REQUIRE(rx.recv() == 42);
+
+    stats = rx.stats();
+    REQUIRE(1 == stats.received);
+    REQUIRE(0 == stats.depth);
+    REQUIRE(1 == stats.high_water);
+}
+
+TEST_CASE("wmp::oneshot counts a parked receiver")
+{
+    auto [tx, rx] = oneshot::create<int>();
+
+    REQUIRE_FALSE(rx.recv_timeout(20ms).has_value());
+
+    auto const stats = rx.stats();
+    REQUIRE(1 == stats.receiver_parks);
+    REQUIRE(0 == stats.sender_blocks);
+    REQUIRE(stats.blocked_time >= 20ms);
+}
+
+TEST_CASE("wmp::watch counts broadcasts and deliveries")
+{
+    auto [tx, rx] = watch::create<int>(0);
+    auto rx2 = rx.clone();
+
+    REQUIRE(watch::send_result::success == tx.broadcast(1));
+    REQUIRE(watch::send_result::success == tx.broadcast(2));
+
+    // each receiver observes only the latest version
+    REQUIRE(rx.recv() == 2);
+    REQUIRE(rx2.recv() == 2);
+
+    auto const stats = tx.stats();
+    REQUIRE(2 == stats.sent);
+    REQUIRE(2 == stats.received);
+    REQUIRE(0 == stats.depth);
+
+    REQUIRE_FALSE(rx.recv_timeout(20ms).has_value());
+    REQUIRE(1 == rx.stats().receiver_parks);
+    REQUIRE(rx.stats().blocked_time >= 20ms);
+}
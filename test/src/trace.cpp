@@ -0,0 +1,180 @@
+// trace.cpp
+//
+// Unit tests for event tracing; requires WMP_TRACE.
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <sstream>
+
+#include <wmp/mpsc.hpp>
+#include <wmp/trace.hpp>
+#include <wmp/oneshot.hpp>
+
+using namespace wmp;
+
+namespace
+{
+    // the events still held by the calling thread's ring
+    auto local_events() -> std::vector<wmp::detail::trace_record>
+    {
+        auto records = std::vector<wmp::detail::trace_record>{};
+        wmp::detail::trace_local()->snapshot(records);
+        return records;
+    }
+}
+
+TEST_CASE("wmp::trace records sends and receives on the calling thread")
+{
+    auto [tx, rx] = mpsc::create<int>(8);
+
+    REQUIRE(mpsc::send_result::success == tx.send(1));
+    auto const values = std::vector<int>{2, 3};
+    REQUIRE(2 == tx.try_send_many(values.begin(), values.end()));
+    REQUIRE(rx.recv() == 1);
+
+    auto const records = local_events();
+    REQUIRE(records.size() >= 3);
+
+    auto const* const channel = records.back().object;
+    auto const n = records.size();
+
+    REQUIRE(wmp::detail::trace_kind::send == records[n - 3].kind);
+    REQUIRE(1 == records[n - 3].arg);
+    REQUIRE(wmp::detail::trace_kind::send == records[n - 2].kind);
+    REQUIRE(2 == records[n - 2].arg);
+    REQUIRE(wmp::detail::trace_kind::recv == records[n - 1].kind);
+    REQUIRE(wmp::detail::trace_source::mpsc == records[n - 1].source);
+    REQUIRE(records[n - 3].object == channel);
+
+    // timestamps are monotonic on a single thread
+    REQUIRE(records[n - 3].tsc <= records[n - 2].tsc);
+    REQUIRE(records[n - 2].tsc <= records[n - 1].tsc);
+}
+
+TEST_CASE("wmp::trace keeps only the most recent events of a thread")
+{
+    auto [tx, rx] = mpsc::create_unbounded<int>();
+
+    for (auto i = 0; i < 3 * WMP_TRACE_CAPACITY; ++i)
+    {
+        tx.send(i);
+    }
+
+    // a full ring conservatively withholds its oldest slot, which a
+    // concurrent writer could be reusing
+    auto const records = local_events();
+    REQUIRE(WMP_TRACE_CAPACITY - 1 == records.size());
+    for (auto const& r : records)
+    {
+        REQUIRE(wmp::detail::trace_kind::send == r.kind);
+    }
+}
+
+TEST_CASE("wmp::trace records a block with its duration")
+{
+    auto [tx, rx] = oneshot::create<int>();
+
+    REQUIRE_FALSE(rx.recv_timeout(std::chrono::milliseconds{10}).has_value());
+
+    auto const records = local_events();
+    REQUIRE_FALSE(records.empty());
+    REQUIRE(wmp::detail::trace_kind::block == records.back().kind);
+    REQUIRE(wmp::detail::trace_source::backend == records.back().source);
+    REQUIRE(records.back().arg > 0);
+}
+
+TEST_CASE("wmp::trace records wakes across threads")
+{
+    auto [tx, rx] = oneshot::create<int>();
+
+    auto received         = std::optional<int>{};
+    auto consumer_records = std::vector<wmp::detail::trace_record>{};
+    auto consumer = std::thread{[&rx = rx, &received, &consumer_records]() {
+        received         = rx.recv();
+        consumer_records = local_events();
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    REQUIRE(oneshot::send_result::success == tx.send_async(42));
+    consumer.join();
+
+    // the receiver may have been woken without ever parking, in which
+    // case there is no block to observe
+    REQUIRE(received == 42);
+    REQUIRE_FALSE(consumer_records.empty());
+    REQUIRE(wmp::detail::trace_kind::recv == consumer_records.back().kind);
+    REQUIRE(wmp::detail::trace_source::oneshot == consumer_records.back().source);
+
+    // the send, followed by the wake of the receiver if it had parked
+    auto const records = local_events();
+    auto const n = records.size();
+    REQUIRE(n >= 1);
+    if (wmp::detail::trace_kind::wake == records[n - 1].kind)
+    {
+        REQUIRE(wmp::detail::trace_source::backend == records[n - 1].source);
+        REQUIRE(wmp::detail::trace_kind::send == records[n - 2].kind);
+    }
+    else
+    {
+        REQUIRE(wmp::detail::trace_kind::send == records[n - 1].kind);
+    }
+}
+
+TEST_CASE("wmp::trace reuses the rings of exited threads")
+{
+    auto& registry = wmp::detail::trace_registry_instance();
+    auto [tx, rx] = mpsc::create_unbounded<int>();
+
+    auto record_on_new_thread = [&tx = tx]() {
+        auto t = std::thread{[&tx]() { tx.send(1); }};
+        t.join();
+    };
+
+    record_on_new_thread();
+    auto const before = registry.rings().size();
+
+    for (auto i = 0; i < 8; ++i)
+    {
+        record_on_new_thread();
+    }
+
+    REQUIRE(before == registry.rings().size());
+}
+
+TEST_CASE("wmp::trace writes Chrome trace JSON")
+{
+    auto [tx, rx] = mpsc::create<int>(1);
+
+    auto received = std::vector<std::optional<int>>{};
+    auto consumer = std::thread{[&rx = rx, &received]() {
+        for (auto i = 0; i < 4; ++i)
+        {
+            received.push_back(rx.recv());
+        }
+    }};
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(mpsc::send_result::success == tx.send(i));
+    }
+    consumer.join();
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(received[i] == i);
+    }
+
+    auto out = std::ostringstream{};
+    trace::write_chrome_json(out);
+
+    auto const json = out.str();
+    REQUIRE(0 == json.rfind("{\"traceEvents\":[", 0));
+    REQUIRE(json.find("\"ph\":\"M\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"send\",\"cat\":\"mpsc\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"recv\",\"cat\":\"mpsc\"") != std::string::npos);
+    REQUIRE(json.find("\"displayTimeUnit\":\"ns\"}") != std::string::npos);
+}
@@ -2,6 +2,12 @@
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 #include <utility>
 
 #include <wmp/watch.hpp>
@@ -14,4 +20,180 @@ TEST_CASE("wmp::watch channel closed when final receiver handle dropped")
 
     // all receiver handles dropped; channel is closed
     REQUIRE(true);
-}
\ No newline at end of file
+}
+TEST_CASE("wmp::watch move-only payload observed through borrow()")
+{
+    auto [tx, rx] = watch::create(std::make_unique<uint32_t>(1));
+
+    {
+        auto const b = rx.borrow();
+        REQUIRE(**b == 1);
+    }
+
+    REQUIRE(watch::send_result::success == tx.broadcast(std::make_unique<uint32_t>(2)));
+    REQUIRE(watch::send_result::success == tx.emplace_broadcast(new uint32_t{3}));
+
+    auto const b = rx.borrow();
+    REQUIRE(**b == 3);
+}
+
+namespace
+{
+    // a trivially copyable value whose fields must always agree
+    struct tick
+    {
+        uint64_t sequence;
+        uint64_t price;
+        uint64_t check;
+    };
+}
+
+TEST_CASE("wmp::watch trivially copyable values are seqlocked")
+{
+    STATIC_REQUIRE(watch::detail::is_seqlocked_v<tick>);
+    STATIC_REQUIRE_FALSE(watch::detail::is_seqlocked_v<std::unique_ptr<uint32_t>>);
+
+    auto [tx, rx] = watch::create(tick{0, 0, 0});
+
+    // an outstanding borrow of a seqlocked value never blocks the sender
+    auto const b = rx.borrow();
+    REQUIRE(watch::send_result::success == tx.broadcast(tick{1, 10, 11}));
+    REQUIRE((*b).sequence == 0);
+
+    auto const v1 = rx.recv();
+    REQUIRE(v1.has_value());
+    REQUIRE(v1->sequence == 1);
+
+    REQUIRE(watch::send_result::success == tx.broadcast(tick{2, 20, 22}));
+    auto const v2 = rx.recv();
+    REQUIRE(v2.has_value());
+    REQUIRE(v2->sequence == 2);
+}
+
+TEST_CASE("wmp::watch seqlocked readers never observe a torn value")
+{
+    constexpr static auto const N_READERS = 4;
+    constexpr static auto const N_UPDATES = 20000;
+
+    auto [tx, rx] = watch::create(tick{0, 0, 0});
+
+    auto torn = std::atomic<int>{0};
+
+    auto readers = std::vector<std::thread>{};
+    for (auto r = 0; r < N_READERS; ++r)
+    {
+        readers.emplace_back(
+            [&torn, rx = rx.clone()]() mutable
+            {
+                auto last = uint64_t{0};
+                while (auto v = rx.recv())
+                {
+                    if (v->price + v->sequence != v->check || v->sequence < last)
+                    {
+                        ++torn;
+                    }
+                    last = v->sequence;
+
+                    auto const b = rx.borrow();
+                    if ((*b).price + (*b).sequence != (*b).check)
+                    {
+                        ++torn;
+                    }
+                }
+            });
+    }
+
+    for (auto i = uint64_t{1}; i <= N_UPDATES; ++i)
+    {
+        tx.broadcast(tick{i, i * 7, i * 8});
+    }
+
+    // dropping the sender closes the channel
+    {
+        auto drop = std::move(tx);
+    }
+
+    for (auto& r : readers)
+    {
+        r.join();
+    }
+
+    REQUIRE(0 == torn.load());
+}
+
+TEST_CASE("wmp::watch blocked receivers are all woken by a broadcast")
+{
+    constexpr static auto const N_RECEIVERS = 8;
+
+    auto [tx, rx] = watch::create<std::string>("initial");
+    REQUIRE(rx.recv() == "initial");
+
+    auto woken = std::atomic<int>{0};
+
+    auto receivers = std::vector<std::thread>{};
+    for (auto r = 0; r < N_RECEIVERS; ++r)
+    {
+        receivers.emplace_back(
+            [&woken, rx = rx.clone()]() mutable
+            {
+                // cloned receivers have already observed the initial value
+                if (rx.recv() == "updated")
+                {
+                    ++woken;
+                }
+
+                // the final recv() observes the sender drop
+                if (!rx.recv().has_value())
+                {
+                    ++woken;
+                }
+            });
+    }
+
+    REQUIRE(watch::send_result::success == tx.broadcast("updated"));
+    {
+        auto drop = std::move(tx);
+    }
+
+    for (auto& r : receivers)
+    {
+        r.join();
+    }
+
+    REQUIRE(2 * N_RECEIVERS == woken.load());
+}
+
+TEST_CASE("wmp::watch recv_timeout() expires without an update")
+{
+    using namespace std::chrono;
+
+    auto [tx, rx] = watch::create<int>(0);
+    REQUIRE(rx.recv_timeout(0ms) == 0);
+
+    auto const start = steady_clock::now();
+    REQUIRE_FALSE(rx.recv_timeout(300us).has_value());
+    REQUIRE(steady_clock::now() - start >= 300us);
+
+    REQUIRE(watch::send_result::success == tx.broadcast(1));
+    REQUIRE(rx.recv_until(steady_clock::now()) == 1);
+}
+
+TEST_CASE("wmp::watch move-assigning a sender closes the channel it held")
+{
+    using namespace std::chrono;
+
+    auto [tx1, rx1] = watch::create<int>(0);
+    auto [tx2, rx2] = watch::create<int>(0);
+    REQUIRE(rx1.recv_timeout(0ms) == 0);
+    REQUIRE(rx2.recv_timeout(0ms) == 0);
+
+    tx1 = std::move(tx2);
+
+    // the first channel is closed, so its receiver returns without waiting
+    auto const start = steady_clock::now();
+    REQUIRE_FALSE(rx1.recv_timeout(10s).has_value());
+    REQUIRE(steady_clock::now() - start < 10s);
+
+    REQUIRE(watch::send_result::success == tx1.broadcast(1));
+    REQUIRE(rx2.recv_timeout(0ms) == 1);
+}